@@ -8,6 +8,7 @@
 #include "Engine/ActorChannel.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Net/UnrealNetwork.h"
+#include "SubSystem/DialogueParticipantSubsystem.h"
 
 // Define to use new replication system introduced in UE 5.1.0.
 #define USE_NEW_REPLICATION !UE_VERSION_OLDER_THAN(5, 1, 0) && true
@@ -24,6 +25,69 @@ UDialogueParticipantComponent::UDialogueParticipantComponent()
 	
 }
 
+void UDialogueParticipantComponent::SetParticipantTags(const FGameplayTagContainer& NewTags)
+{
+	if (ParticipantTag == NewTags) return;
+
+	const FGameplayTagContainer OldTags = ParticipantTag;
+
+	ParticipantTag = NewTags;
+
+	NotifyParticipantTagChanged(OldTags);
+}
+
+void UDialogueParticipantComponent::AddParticipantTag(const FGameplayTag& TagToAdd)
+{
+	if (!TagToAdd.IsValid() || ParticipantTag.HasTagExact(TagToAdd)) return;
+
+	const FGameplayTagContainer OldTags = ParticipantTag;
+
+	ParticipantTag.AddTag(TagToAdd);
+
+	NotifyParticipantTagChanged(OldTags);
+}
+
+void UDialogueParticipantComponent::RemoveParticipantTag(const FGameplayTag& TagToRemove)
+{
+	if (!ParticipantTag.HasTagExact(TagToRemove)) return;
+
+	const FGameplayTagContainer OldTags = ParticipantTag;
+
+	ParticipantTag.RemoveTag(TagToRemove);
+
+	NotifyParticipantTagChanged(OldTags);
+}
+
+void UDialogueParticipantComponent::NotifyParticipantTagChanged(const FGameplayTagContainer& OldTags)
+{
+	if (UDialogueParticipantSubsystem* Subsystem = UDialogueParticipantSubsystem::Get(this))
+	{
+		Subsystem->NotifyParticipantTagChanged(this);
+	}
+
+	if (OnParticipantTagChanged.IsBound()) OnParticipantTagChanged.Broadcast(this, OldTags, ParticipantTag);
+}
+
+void UDialogueParticipantComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	if (UDialogueParticipantSubsystem* Subsystem = UDialogueParticipantSubsystem::Get(this))
+	{
+		Subsystem->RegisterParticipant(this);
+	}
+}
+
+void UDialogueParticipantComponent::OnUnregister()
+{
+	if (UDialogueParticipantSubsystem* Subsystem = UDialogueParticipantSubsystem::Get(this))
+	{
+		Subsystem->UnregisterParticipant(this);
+	}
+
+	Super::OnUnregister();
+}
+
 UDialogueParticipantModuleItem* UDialogueParticipantComponent::GetParticipantModuleByClass(TSubclassOf<UDialogueParticipantModuleItem> ModuleClass) const
 {
 	for (UDialogueParticipantModuleItem* ModuleItem : ParticipantModules)
@@ -2,6 +2,7 @@
 
 
 #include "ICUTransliteratorWrapper.h"
+#include "JointNativeTransliteratorPool.h"
 
 
 #if UE_ENABLE_ICU
@@ -33,12 +34,8 @@ void UICUTransliteratorWrapper::ReleaseTransliterator()
 
 	if (TransliteratorInstance != nullptr)
 	{
-		icu::Transliterator::unregister(TransliteratorInstance->getID());
-
-		if (TransliteratorInstance)
-		{
-			delete TransliteratorInstance;
-		}
+		//The instance is a clone of the pooled transliterator and was never registered on ICU, so we don't unregister its ID here. (That would remove the system transliterator of the rule.)
+		delete TransliteratorInstance;
 		
 		TransliteratorInstance = nullptr;
 	}
@@ -58,16 +55,13 @@ void UICUTransliteratorWrapper::CreateTransliterator(const FName TransformRule)
 #endif
 	}
 
-	const icu::UnicodeString RuleString(*TransformRule.ToString());
-
-	UErrorCode Status = U_ZERO_ERROR;
-
-	TransliteratorInstance = icu::Transliterator::createInstance(RuleString, UTRANS_FORWARD, Status);
+	//Joint Native 1.16: Clone the compiled transliterator of the pool instead of compiling the rule for each wrapper.
+	TransliteratorInstance = FJointNativeTransliteratorPool::Get().CloneTransliterator(TransformRule);
 	
 	if (TransliteratorInstance == nullptr)
 	{
 #if UE_BUILD_DEBUG
-		if(GEngine) GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, TEXT("UJointNativeFunctionLibrary : Failed to create a ICU transliterator, Error code : %d.\nPlease change 'Internationalization Support' under project settings > packaging to include the localization data for the languages if you want to use transliteration or ICU code on the final build.\nIf this message still be displayed after you included localization data, please report this to the creator of the plugin."), Status);	
+		if(GEngine) GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, TEXT("UJointNativeFunctionLibrary : Failed to create a ICU transliterator for the rule (%s).\nPlease change 'Internationalization Support' under project settings > packaging to include the localization data for the languages if you want to use transliteration or ICU code on the final build.\nIf this message still be displayed after you included localization data, please report this to the creator of the plugin."), *TransformRule.ToString());	
 #endif
 	}
 
@@ -83,20 +77,45 @@ FString UICUTransliteratorWrapper::TransliterateString(const FString Str)
 
 	if (TransliteratorInstance == nullptr) return OutString;
 
-	icu::UnicodeString Output = icu::UnicodeString(*Str);
+	icu::UnicodeString Output;
+	FJointNativeTransliteratorPool::ConvertString(Str, Output);
 
 	TransliteratorInstance->transliterate(Output);
 
-	std::string ConvertStr;
-	Output.toUTF8String(ConvertStr);
-
-	OutString = FString(ConvertStr.c_str());
+	FJointNativeTransliteratorPool::ConvertString(Output, OutString);
 
 #endif
 
 	return OutString;
 }
 
+TArray<FString> UICUTransliteratorWrapper::TransliterateStrings(const TArray<FString>& Strs)
+{
+	TArray<FString> OutStrings = Strs;
+
+#if UE_ENABLE_ICU
+
+	if (TransliteratorInstance == nullptr) return OutStrings;
+
+	//Reuse the same buffer for the whole batch.
+	icu::UnicodeString Buffer;
+
+	for (FString& Str : OutStrings)
+	{
+		if (Str.IsEmpty()) continue;
+
+		FJointNativeTransliteratorPool::ConvertString(Str, Buffer);
+
+		TransliteratorInstance->transliterate(Buffer);
+
+		FJointNativeTransliteratorPool::ConvertString(Buffer, Str);
+	}
+
+#endif
+
+	return OutStrings;
+}
+
 
 #if UE_ENABLE_ICU
 #define SAVED_TRANSLITERATION UCONFIG_NO_TRANSLITERATION
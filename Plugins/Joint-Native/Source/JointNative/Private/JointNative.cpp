@@ -2,6 +2,8 @@
 
 #include "JointNative.h"
 
+#include "JointNativeTransliteratorPool.h"
+
 #define LOCTEXT_NAMESPACE "FJointNativeModule"
 
 void FJointNativeModule::StartupModule()
@@ -13,6 +15,9 @@ void FJointNativeModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	// Release the cached ICU transliterators while ICU is still alive.
+	FJointNativeTransliteratorPool::Get().Reset();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -4,8 +4,12 @@
 #include "JointNativeFunctionLibrary.h"
 #include "GameplayTagContainer.h"
 #include "ICUTransliteratorWrapper.h"
+#include "JointNativeTransliteratorPool.h"
 #include "SceneView.h"
 #include "Component/DialogueParticipantComponent.h"
+#include "Node/DF_Participant.h"
+#include "Node/DF_SpeakerAndListener.h"
+#include "SubSystem/DialogueParticipantSubsystem.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/LocalPlayer.h"
 #include "Kismet/GameplayStatics.h"
@@ -13,6 +17,12 @@
 UDialogueParticipantComponent* UJointNativeFunctionLibrary::FindFirstParticipantComponent(
 	UObject* WorldContextObject, FGameplayTag TargetParticipantTag)
 {
+	if (const UDialogueParticipantSubsystem* Subsystem = UDialogueParticipantSubsystem::Get(WorldContextObject))
+	{
+		return Subsystem->FindFirstParticipantComponent(TargetParticipantTag);
+	}
+
+	// Fallback for the worlds that don't have the participant subsystem.
 	if (const UWorld* World = WorldContextObject->GetWorld())
 	{
 		for (TObjectIterator<UDialogueParticipantComponent> Itr; Itr; ++Itr)
@@ -35,6 +45,12 @@ UDialogueParticipantComponent* UJointNativeFunctionLibrary::FindFirstParticipant
 TArray<UDialogueParticipantComponent*> UJointNativeFunctionLibrary::FindParticipantComponents(
 	UObject* WorldContextObject, FGameplayTag TargetParticipantTag)
 {
+	if (const UDialogueParticipantSubsystem* Subsystem = UDialogueParticipantSubsystem::Get(WorldContextObject))
+	{
+		return Subsystem->FindParticipantComponents(TargetParticipantTag);
+	}
+	
+	// Fallback for the worlds that don't have the participant subsystem.
 	const UWorld* World = WorldContextObject->GetWorld();
 
 
@@ -59,6 +75,12 @@ TArray<UDialogueParticipantComponent*> UJointNativeFunctionLibrary::FindParticip
 TArray<UDialogueParticipantComponent*> UJointNativeFunctionLibrary::GetAllParticipantComponents(
 	UObject* WorldContextObject)
 {
+	if (const UDialogueParticipantSubsystem* Subsystem = UDialogueParticipantSubsystem::Get(WorldContextObject))
+	{
+		return Subsystem->GetAllParticipantComponents();
+	}
+	
+	// Fallback for the worlds that don't have the participant subsystem.
 	const UWorld* World = WorldContextObject->GetWorld();
 
 	TSet<UDialogueParticipantComponent*> Comps;
@@ -77,6 +99,99 @@ TArray<UDialogueParticipantComponent*> UJointNativeFunctionLibrary::GetAllPartic
 	return Comps.Array();
 }
 
+void UJointNativeFunctionLibrary::ResolveSpeakersAndListeners(
+	UJointNodeBase* Node,
+	TArray<UDialogueParticipantComponent*>& OutSpeakers,
+	TArray<UDialogueParticipantComponent*>& OutListeners)
+{
+	OutSpeakers.Reset();
+	OutListeners.Reset();
+
+	if (!Node) return;
+
+	TArray<UDF_SpeakerAndListener*> SpeakerAndListeners;
+
+	if (UDF_SpeakerAndListener* SelfSpeakerAndListener = Cast<UDF_SpeakerAndListener>(Node))
+	{
+		SpeakerAndListeners.Add(SelfSpeakerAndListener);
+	}
+
+	for (UJointFragment* Fragment : Node->GetAllFragmentsOnLowerHierarchy())
+	{
+		if (UDF_SpeakerAndListener* SpeakerAndListener = Cast<UDF_SpeakerAndListener>(Fragment))
+		{
+			SpeakerAndListeners.Add(SpeakerAndListener);
+		}
+	}
+
+	if (SpeakerAndListeners.IsEmpty()) return;
+
+	TArray<UDF_Participant*> Speakers;
+	TArray<UDF_Participant*> Listeners;
+
+	for (const UDF_SpeakerAndListener* SpeakerAndListener : SpeakerAndListeners)
+	{
+		Speakers.Append(SpeakerAndListener->GetSpeakerParticipants());
+		Listeners.Append(SpeakerAndListener->GetListenerParticipants());
+	}
+
+	// Collect the tags of the participants that don't have the instance yet, and resolve them all at once.
+	TArray<FGameplayTag, TInlineAllocator<8>> TagsToResolve;
+
+	auto CollectTagsToResolve = [&TagsToResolve](const TArray<UDF_Participant*>& Participants)
+	{
+		for (const UDF_Participant* Participant : Participants)
+		{
+			if (Participant && !Participant->ParticipantComponentInstance && Participant->bAllowCollectingParticipantComponentOnWorldAutomatically)
+			{
+				TagsToResolve.AddUnique(Participant->ParticipantTag);
+			}
+		}
+	};
+
+	CollectTagsToResolve(Speakers);
+	CollectTagsToResolve(Listeners);
+
+	TMap<FGameplayTag, UDialogueParticipantComponent*> ResolvedComponents;
+
+	if (!TagsToResolve.IsEmpty())
+	{
+		if (const UDialogueParticipantSubsystem* Subsystem = UDialogueParticipantSubsystem::Get(Node))
+		{
+			Subsystem->FindFirstParticipantComponentsForTags(TagsToResolve, ResolvedComponents);
+		}
+		else
+		{
+			for (const FGameplayTag& Tag : TagsToResolve)
+			{
+				if (UDialogueParticipantComponent* Comp = FindFirstParticipantComponent(Node, Tag)) ResolvedComponents.Add(Tag, Comp);
+			}
+		}
+	}
+
+	auto ResolveParticipants = [&ResolvedComponents](const TArray<UDF_Participant*>& Participants, TArray<UDialogueParticipantComponent*>& OutComponents)
+	{
+		OutComponents.Reserve(Participants.Num());
+
+		for (const UDF_Participant* Participant : Participants)
+		{
+			if (!Participant) continue;
+
+			UDialogueParticipantComponent* Comp = Participant->ParticipantComponentInstance;
+
+			if (!Comp)
+			{
+				if (UDialogueParticipantComponent* const* Found = ResolvedComponents.Find(Participant->ParticipantTag)) Comp = *Found;
+			}
+
+			if (Comp) OutComponents.AddUnique(Comp);
+		}
+	};
+
+	ResolveParticipants(Speakers, OutSpeakers);
+	ResolveParticipants(Listeners, OutListeners);
+}
+
 
 void UJointNativeFunctionLibrary::ProjectWorldPositionToScreenPosition(const UObject* WorldContextObject,
                                                                        const FVector& InWorldPosition,
@@ -154,6 +269,24 @@ UICUTransliteratorWrapper* UJointNativeFunctionLibrary::CreateTransliterator(con
 	return ICUTransliteratorWrapper;
 }
 
+FString UJointNativeFunctionLibrary::TransliterateString(const FName TransformRule, const FString& Str)
+{
+	FString OutString = Str;
+
+	FJointNativeTransliteratorPool::Get().Transliterate(TransformRule, OutString);
+
+	return OutString;
+}
+
+TArray<FString> UJointNativeFunctionLibrary::TransliterateStrings(const FName TransformRule, const TArray<FString>& Strs)
+{
+	TArray<FString> OutStrings = Strs;
+
+	FJointNativeTransliteratorPool::Get().TransliterateStrings(TransformRule, OutStrings);
+
+	return OutStrings;
+}
+
 #if UE_ENABLE_ICU
 #define SAVED_TRANSLITERATION UCONFIG_NO_TRANSLITERATION
 #undef UCONFIG_NO_TRANSLITERATION
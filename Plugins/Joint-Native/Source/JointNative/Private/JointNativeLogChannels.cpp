@@ -0,0 +1,3 @@
+﻿#include "JointNativeLogChannels.h"
+
+DEFINE_LOG_CATEGORY(LogJointNative);
@@ -0,0 +1,14 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "JointNativeSettings.h"
+
+UJointNativeSettings::UJointNativeSettings()
+{
+	
+}
+
+UJointNativeSettings* UJointNativeSettings::Get()
+{
+	return GetMutableDefault<UJointNativeSettings>();
+}
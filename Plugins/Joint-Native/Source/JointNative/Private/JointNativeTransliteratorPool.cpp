@@ -0,0 +1,301 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "JointNativeTransliteratorPool.h"
+
+#include "JointNativeLogChannels.h"
+
+#include "Misc/ScopeLock.h"
+
+#if UE_ENABLE_ICU
+#define SAVED_TRANSLITERATION UCONFIG_NO_TRANSLITERATION
+#undef UCONFIG_NO_TRANSLITERATION
+#define UCONFIG_NO_TRANSLITERATION 0
+THIRD_PARTY_INCLUDES_START
+#include <unicode/utrans.h>
+#include <unicode/translit.h>
+THIRD_PARTY_INCLUDES_END
+#endif
+
+//The number of the idle clones we keep per rule. Extra clones will be deleted on the release.
+#define JOINT_NATIVE_MAX_IDLE_TRANSLITERATORS_PER_RULE 4
+
+//The number of the latest transliteration results we keep. Enough for the upcoming lines of a few dialogues.
+#define JOINT_NATIVE_MAX_CACHED_TRANSLITERATIONS 128
+
+
+struct FJointNativeTransliteratorPoolEntry
+{
+public:
+
+	~FJointNativeTransliteratorPoolEntry()
+	{
+#if UE_ENABLE_ICU
+		for (const icu::Transliterator* FreeInstance : FreeInstances) delete FreeInstance;
+
+		FreeInstances.Empty();
+#endif
+	}
+
+public:
+
+#if UE_ENABLE_ICU
+
+	//Acquire an instance that only the caller will use until it gets released. Prototype must be valid.
+	icu::Transliterator* Acquire()
+	{
+		{
+			FScopeLock Lock(&Mutex);
+
+			if (!FreeInstances.IsEmpty()) return FreeInstances.Pop(false);
+		}
+
+		//Cloning doesn't recompile the rule set.
+		return Prototype->clone();
+	}
+
+	void Release(icu::Transliterator* Instance)
+	{
+		if (Instance == nullptr) return;
+
+		{
+			FScopeLock Lock(&Mutex);
+
+			if (FreeInstances.Num() < JOINT_NATIVE_MAX_IDLE_TRANSLITERATORS_PER_RULE)
+			{
+				FreeInstances.Add(Instance);
+
+				return;
+			}
+		}
+
+		delete Instance;
+	}
+
+public:
+
+	/**
+	 * The compiled transliterator for the rule. Only used to create the clones, never used for the transliteration itself.
+	 * nullptr if the rule couldn't be compiled - we keep the entry to avoid recompiling the failing rule every time.
+	 */
+	TUniquePtr<icu::Transliterator> Prototype;
+
+	TArray<icu::Transliterator*> FreeInstances;
+
+#endif
+
+	FCriticalSection Mutex;
+
+};
+
+
+FJointNativeTransliteratorPool& FJointNativeTransliteratorPool::Get()
+{
+	static FJointNativeTransliteratorPool Instance;
+
+	return Instance;
+}
+
+TSharedPtr<FJointNativeTransliteratorPoolEntry> FJointNativeTransliteratorPool::FindOrCreateEntry(const FName& TransformRule)
+{
+	FScopeLock Lock(&EntriesMutex);
+
+	if (const TSharedPtr<FJointNativeTransliteratorPoolEntry>* FoundEntry = Entries.Find(TransformRule))
+	{
+		return *FoundEntry;
+	}
+
+	TSharedPtr<FJointNativeTransliteratorPoolEntry> NewEntry = MakeShared<FJointNativeTransliteratorPoolEntry>();
+
+#if UE_ENABLE_ICU
+
+	icu::UnicodeString RuleString;
+	ConvertString(TransformRule.ToString(), RuleString);
+
+	UErrorCode Status = U_ZERO_ERROR;
+
+	NewEntry->Prototype.Reset(icu::Transliterator::createInstance(RuleString, UTRANS_FORWARD, Status));
+
+	if (!NewEntry->Prototype.IsValid() || U_FAILURE(Status))
+	{
+		NewEntry->Prototype.Reset();
+
+		UE_LOG(LogJointNative, Warning, TEXT("FJointNativeTransliteratorPool : Failed to create a ICU transliterator for the rule (%s), Error code : %d. Please check out whether the project includes the culture-specific ICU data for the languages."), *TransformRule.ToString(), static_cast<int32>(Status));
+	}
+
+#endif
+
+	Entries.Add(TransformRule, NewEntry);
+
+	return NewEntry;
+}
+
+bool FJointNativeTransliteratorPool::Transliterate(const FName& TransformRule, FString& InOutString)
+{
+	return TransliterateStrings(TransformRule, TArrayView<FString>(&InOutString, 1));
+}
+
+bool FJointNativeTransliteratorPool::TransliterateStrings(const FName& TransformRule, TArrayView<FString> InOutStrings)
+{
+#if UE_ENABLE_ICU
+
+	const TSharedPtr<FJointNativeTransliteratorPoolEntry> Entry = FindOrCreateEntry(TransformRule);
+
+	if (!Entry.IsValid() || !Entry->Prototype.IsValid()) return false;
+
+	//Acquired on the first string that is not cached.
+	icu::Transliterator* Instance = nullptr;
+
+	//Reuse the same buffer for the whole batch.
+	icu::UnicodeString Buffer;
+
+	for (FString& Str : InOutStrings)
+	{
+		if (Str.IsEmpty() || FindCachedResult(TransformRule, Str, Str)) continue;
+
+		if (Instance == nullptr) Instance = Entry->Acquire();
+
+		if (Instance == nullptr) return false;
+
+		const FString Source = Str;
+
+		ConvertString(Str, Buffer);
+
+		Instance->transliterate(Buffer);
+
+		ConvertString(Buffer, Str);
+
+		CacheResult(TransformRule, Source, Str);
+	}
+
+	Entry->Release(Instance);
+
+	return true;
+
+#else
+
+	return false;
+
+#endif
+}
+
+bool FJointNativeTransliteratorPool::IsRuleAvailable(const FName& TransformRule)
+{
+#if UE_ENABLE_ICU
+
+	const TSharedPtr<FJointNativeTransliteratorPoolEntry> Entry = FindOrCreateEntry(TransformRule);
+
+	return Entry.IsValid() && Entry->Prototype.IsValid();
+
+#else
+
+	return false;
+
+#endif
+}
+
+bool FJointNativeTransliteratorPool::FindCachedResult(const FName& TransformRule, const FString& Source, FString& OutResult)
+{
+	FScopeLock Lock(&ResultsMutex);
+
+	if (const FString* Found = Results.Find(TPair<FName, FString>(TransformRule, Source)))
+	{
+		OutResult = *Found;
+
+		return true;
+	}
+
+	return false;
+}
+
+void FJointNativeTransliteratorPool::CacheResult(const FName& TransformRule, const FString& Source, const FString& Result)
+{
+	FScopeLock Lock(&ResultsMutex);
+
+	TPair<FName, FString> Key(TransformRule, Source);
+
+	if (!Results.Contains(Key)) ResultOrder.Add(Key);
+
+	Results.Add(MoveTemp(Key), Result);
+
+	while (ResultOrder.Num() > JOINT_NATIVE_MAX_CACHED_TRANSLITERATIONS)
+	{
+		Results.Remove(ResultOrder[0]);
+		ResultOrder.RemoveAt(0, 1, false);
+	}
+}
+
+#if UE_ENABLE_ICU
+
+icu::Transliterator* FJointNativeTransliteratorPool::CloneTransliterator(const FName& TransformRule)
+{
+	const TSharedPtr<FJointNativeTransliteratorPoolEntry> Entry = FindOrCreateEntry(TransformRule);
+
+	if (!Entry.IsValid() || !Entry->Prototype.IsValid()) return nullptr;
+
+	return Entry->Prototype->clone();
+}
+
+void FJointNativeTransliteratorPool::ConvertString(const FString& Source, icu::UnicodeString& Destination)
+{
+#if PLATFORM_TCHAR_IS_4_BYTES
+
+	const auto Converted = StringCast<UTF16CHAR>(*Source, Source.Len());
+
+	Destination.setTo(reinterpret_cast<const UChar*>(Converted.Get()), Converted.Length());
+
+#else
+
+	//TCHAR is already UTF-16 here, so we can copy the buffer as it is.
+	Destination.setTo(reinterpret_cast<const UChar*>(*Source), Source.Len());
+
+#endif
+}
+
+void FJointNativeTransliteratorPool::ConvertString(const icu::UnicodeString& Source, FString& Destination)
+{
+	const UChar* SourceBuffer = Source.getBuffer();
+	const int32 SourceLength = Source.length();
+
+	Destination.Reset(SourceLength);
+
+	if (SourceBuffer == nullptr || SourceLength == 0) return;
+
+#if PLATFORM_TCHAR_IS_4_BYTES
+
+	const auto Converted = StringCast<TCHAR>(reinterpret_cast<const UTF16CHAR*>(SourceBuffer), SourceLength);
+
+	Destination.AppendChars(Converted.Get(), Converted.Length());
+
+#else
+
+	Destination.AppendChars(reinterpret_cast<const TCHAR*>(SourceBuffer), SourceLength);
+
+#endif
+}
+
+#endif
+
+void FJointNativeTransliteratorPool::Reset()
+{
+	FScopeLock Lock(&EntriesMutex);
+
+	//The entries that are being used at this moment will be kept alive by their users.
+	Entries.Empty();
+
+	FScopeLock ResultsLock(&ResultsMutex);
+
+	Results.Empty();
+	ResultOrder.Empty();
+}
+
+
+#undef JOINT_NATIVE_MAX_IDLE_TRANSLITERATORS_PER_RULE
+#undef JOINT_NATIVE_MAX_CACHED_TRANSLITERATIONS
+
+#if UE_ENABLE_ICU
+#define SAVED_TRANSLITERATION UCONFIG_NO_TRANSLITERATION
+#undef UCONFIG_NO_TRANSLITERATION
+#define UCONFIG_NO_TRANSLITERATION SAVED_TRANSLITERATION
+#undef SAVED_TRANSLITERATION
+#endif
@@ -12,12 +12,12 @@ UDF_Branch::UDF_Branch()
 	//Condition node can be attached anywhere.
 }
 
-TArray<UJointNodeBase*> UDF_Branch::SelectNextNodes_Implementation(AJointActor* InHostingDialogueInstance)
+bool UDF_Branch::NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes)
 {
 
 	if(!IsNodeBegunPlay())
 	{
-		return TArray<UJointNodeBase*>();
+		return false;
 	}
 	
 	UJointFragment* Condition = FindFragmentByClass(UDF_Condition::StaticClass());
@@ -26,24 +26,25 @@ TArray<UJointNodeBase*> UDF_Branch::SelectNextNodes_Implementation(AJointActor*
 	{
 		UDF_Condition* CastedCondition = Cast<UDF_Condition>(Condition);
 		
-		if(CastedCondition->bConditionResult)
-		{
-			return TrueNode;
-		}else
+		if(!CastedCondition->bConditionResult)
 		{
 			if(UJointFragment* ChildBranch = FindFragmentByClass(UDF_Branch::StaticClass()))
 			{
-				return ChildBranch->SelectNextNodes(InHostingDialogueInstance);
+				return ChildBranch->SelectNextNodesInto(InHostingJointInstance, OutNodes);
 			}
 
 			if(bUseFalse)
 			{
-				return FalseNode;
+				OutNodes.Append(FalseNode);
+
+				return !FalseNode.IsEmpty();
 			}
 
-			return TArray<UJointNodeBase*>();
+			return false;
 		}
 	}
 	
-	return TrueNode;
+	OutNodes.Append(TrueNode);
+
+	return !TrueNode.IsEmpty();
 }
@@ -110,12 +110,13 @@ const FJointEdPinConnectionResponse UDF_Break::CanAttachThisAtParentNode_Impleme
 	return FJointEdPinConnectionResponse(EJointEdCanCreateConnectionResponse::CONNECT_RESPONSE_DISALLOW, INVTEXT("CANNOT CHANGE ATTACHMENT ON RUNTIME"));
 }
 
-TArray<UJointNodeBase*> UDF_Break::SelectNextNodes_Implementation(AJointActor* InHostingDialogueInstance)
+bool UDF_Break::NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes)
 {
-	if ( bIsBroken ) return BreakTo;
-	
-	return TArray<UJointNodeBase*>();
+	if ( !bIsBroken ) return false;
+
+	OutNodes.Append(BreakTo);
 	
+	return !BreakTo.IsEmpty();
 }
 
 bool UDF_Break::IsSupportedForNetworking() const
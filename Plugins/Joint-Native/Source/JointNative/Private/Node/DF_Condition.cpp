@@ -36,7 +36,7 @@ UDF_Condition::UDF_Condition()
 
 void UDF_Condition::SelectNodeAsPlayingNode(UJointNodeBase* SubNode)
 {
-	SubNode->OnJointNodeMarkedAsPendingDelegate.AddDynamic(this, &UDF_Condition::OnSubNodePending);
+	SubNode->OnJointNodeMarkedAsPendingNative.AddUObject(this, &UDF_Condition::OnSubNodePending);
 
 	GetHostingJointInstance()->RequestNodeBeginPlay(SubNode);
 }
@@ -82,11 +82,22 @@ void UDF_Condition::PostNodeBeginPlay_Implementation()
 	PlayNextSubNode();
 }
 
+void UDF_Condition::PostNodeProgressRestored_Implementation()
+{
+	if (!IsNodeActive() || IsNodePending() || !SubNodes.IsValidIndex(CurrentIndex)) return;
+
+	if (UJointNodeBase* SubNode = SubNodes[CurrentIndex])
+	{
+		SubNode->OnJointNodeMarkedAsPendingNative.RemoveAll(this);
+		SubNode->OnJointNodeMarkedAsPendingNative.AddUObject(this, &UDF_Condition::OnSubNodePending);
+	}
+}
+
 void UDF_Condition::OnSubNodePending(UJointNodeBase* InNode)
 {
 	if (InNode == nullptr) return;
 
-	InNode->OnJointNodeMarkedAsPendingDelegate.RemoveDynamic(this, &UDF_Condition::OnSubNodePending);
+	InNode->OnJointNodeMarkedAsPendingNative.RemoveAll(this);
 
 	PlayNextSubNode();
 }
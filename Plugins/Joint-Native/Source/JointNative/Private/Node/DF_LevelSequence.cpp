@@ -8,6 +8,7 @@
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "SubSystem/LevelSequencePlayerPoolSubsystem.h"
 
 UDF_LevelSequence::UDF_LevelSequence()
 {
@@ -42,10 +43,31 @@ void UDF_LevelSequence::ExecuteAction()
 {
 	if (SequenceToPlay.Get())
 	{
-		ALevelSequenceActor* TempActor = nullptr;
-		ULevelSequencePlayer::CreateLevelSequencePlayer(this, SequenceToPlay.Get(), PlaybackSettings,TempActor);
-		CreatedLevelSequenceActor = TempActor;
+		ULevelSequencePlayerPoolSubsystem* PoolSubsystem = bUsePooledActor ? ULevelSequencePlayerPoolSubsystem::Get(this) : nullptr;
+
+		if (PoolSubsystem)
+		{
+			CreatedLevelSequenceActor = PoolSubsystem->AcquireLevelSequenceActor(SequenceToPlay.Get(), PlaybackSettings);
+		}
+		else
+		{
+			ALevelSequenceActor* TempActor = nullptr;
+			ULevelSequencePlayer::CreateLevelSequencePlayer(this, SequenceToPlay.Get(), PlaybackSettings,TempActor);
+			CreatedLevelSequenceActor = TempActor;
+		}
 	}
 
 	RequestNodeEndPlay();
 }
+
+void UDF_LevelSequence::ReleaseLevelSequenceActor()
+{
+	if (CreatedLevelSequenceActor == nullptr || !bUsePooledActor) return;
+
+	if (ULevelSequencePlayerPoolSubsystem* PoolSubsystem = ULevelSequencePlayerPoolSubsystem::Get(this))
+	{
+		PoolSubsystem->ReleaseLevelSequenceActor(CreatedLevelSequenceActor);
+	}
+
+	CreatedLevelSequenceActor = nullptr;
+}
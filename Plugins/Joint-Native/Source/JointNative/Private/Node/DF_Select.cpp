@@ -36,10 +36,13 @@ void UDF_Select::PostNodeBeginPlay_Implementation()
 	Super::PreNodeBeginPlay_Implementation();
 }
 
-TArray<UJointNodeBase*> UDF_Select::SelectNextNodes_Implementation(
-	AJointActor* InHostingDialogueInstance)
+bool UDF_Select::NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes)
 {
-	return bIsSelected ? NextNodes : TArray<UJointNodeBase*>();
+	if (!bIsSelected) return false;
+
+	OutNodes.Append(NextNodes);
+
+	return !NextNodes.IsEmpty();
 }
 
 bool UDF_Select::GetSelected() const
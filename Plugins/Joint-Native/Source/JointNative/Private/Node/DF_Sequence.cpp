@@ -33,8 +33,8 @@ void UDF_Sequence::SelectNodeAsPlayingNode(UJointNodeBase* SubNode)
 	if (IsNodeEndedPlay() || IsNodePending()) return;
 	
 	//if it has the binding, remove it first to avoid invocation list corruption.
-	SubNode->OnJointNodeMarkedAsPendingDelegate.RemoveAll(this);
-	SubNode->OnJointNodeMarkedAsPendingDelegate.AddDynamic(this, &UDF_Sequence::OnSubNodePending);
+	SubNode->OnJointNodeMarkedAsPendingNative.RemoveAll(this);
+	SubNode->OnJointNodeMarkedAsPendingNative.AddUObject(this, &UDF_Sequence::OnSubNodePending);
 
 	GetHostingJointInstance()->RequestNodeBeginPlay(SubNode);
 }
@@ -75,11 +75,23 @@ void UDF_Sequence::PostNodeBeginPlay_Implementation()
 	PlayNextSubNode();
 }
 
+void UDF_Sequence::PostNodeProgressRestored_Implementation()
+{
+	if (!IsNodeActive() || IsNodePending() || !SubNodes.IsValidIndex(CurrentIndex)) return;
+
+	//Listen to the sub node that was playing at the capture again.
+	if (UJointNodeBase* SubNode = SubNodes[CurrentIndex])
+	{
+		SubNode->OnJointNodeMarkedAsPendingNative.RemoveAll(this);
+		SubNode->OnJointNodeMarkedAsPendingNative.AddUObject(this, &UDF_Sequence::OnSubNodePending);
+	}
+}
+
 void UDF_Sequence::OnSubNodePending(UJointNodeBase* InNode)
 {
 	if (InNode == nullptr) return;
 
-	InNode->OnJointNodeMarkedAsPendingDelegate.RemoveDynamic(this, &UDF_Sequence::OnSubNodePending);
+	InNode->OnJointNodeMarkedAsPendingNative.RemoveAll(this);
 
 	PlayNextSubNode();
 }
@@ -5,6 +5,7 @@
 #include "Node/DF_TextStyle.h"
 
 #include "JointVersionComparison.h"
+#include "SubSystem/DialogueTextPrefetchSubsystem.h"
 
 UDF_Text::UDF_Text()
 {
@@ -27,6 +28,33 @@ UDF_Text::UDF_Text()
 #endif
 }
 
+void UDF_Text::PostNodeBeginPlay_Implementation()
+{
+	if (bPrefetchUpcomingTexts)
+	{
+		if (UDialogueTextPrefetchSubsystem* Subsystem = UDialogueTextPrefetchSubsystem::Get(this))
+		{
+			Subsystem->RequestPrefetchUpcomingTexts(this);
+		}
+	}
+
+	Super::PostNodeBeginPlay_Implementation();
+}
+
+FDialoguePreprocessedText UDF_Text::GetPreprocessedText()
+{
+	FDialoguePreprocessedText PreprocessedText;
+
+	if (UDialogueTextPrefetchSubsystem* Subsystem = UDialogueTextPrefetchSubsystem::Get(this))
+	{
+		Subsystem->GetPreprocessedText(this, PreprocessedText);
+
+		return PreprocessedText;
+	}
+
+	return FDialoguePreprocessedText::Preprocess(IJN_Text_Interface::Execute_GetText(this).ToString(), NAME_None);
+}
+
 const FText UDF_Text::GetText_Implementation() const
 {
 	return Text;
@@ -39,9 +67,10 @@ void UDF_Text::SetText_Implementation(const FText& InText)
 
 UDataTable* UDF_Text::GetTextStyleTableIfPresent_Implementation() const
 {
-	if (UDF_TextStyle* Node = RESOLVE_JOINT_POINTER(TextStyleInstance, UDF_TextStyle))
+	//Resolve the soft pointer only once.
+	if (const UDF_TextStyle* Node = Cast<UDF_TextStyle>(TextStyleInstance.Node.Get()))
 	{
-		return Cast<UDF_TextStyle>(TextStyleInstance.Node.Get())->TextStyleTable;
+		return Node->TextStyleTable;
 	}
 
 	return nullptr;
@@ -0,0 +1,171 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "SubSystem/DialogueParticipantSubsystem.h"
+
+#include "Component/DialogueParticipantComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UDialogueParticipantSubsystem* UDialogueParticipantSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UDialogueParticipantSubsystem>();
+	}
+
+	return nullptr;
+}
+
+UDialogueParticipantComponent* UDialogueParticipantSubsystem::FindFirstParticipantComponent(const FGameplayTag& TargetParticipantTag) const
+{
+	if (const TArray<TWeakObjectPtr<UDialogueParticipantComponent>>* Participants = ParticipantIndex.Find(TargetParticipantTag))
+	{
+		for (const TWeakObjectPtr<UDialogueParticipantComponent>& Participant : *Participants)
+		{
+			if (UDialogueParticipantComponent* Comp = Participant.Get(); IsValid(Comp)) return Comp;
+		}
+	}
+
+	return nullptr;
+}
+
+TArray<UDialogueParticipantComponent*> UDialogueParticipantSubsystem::FindParticipantComponents(const FGameplayTag& TargetParticipantTag) const
+{
+	TArray<UDialogueParticipantComponent*> Comps;
+
+	if (const TArray<TWeakObjectPtr<UDialogueParticipantComponent>>* Participants = ParticipantIndex.Find(TargetParticipantTag))
+	{
+		Comps.Reserve(Participants->Num());
+
+		for (const TWeakObjectPtr<UDialogueParticipantComponent>& Participant : *Participants)
+		{
+			if (UDialogueParticipantComponent* Comp = Participant.Get(); IsValid(Comp)) Comps.Add(Comp);
+		}
+	}
+
+	return Comps;
+}
+
+TArray<UDialogueParticipantComponent*> UDialogueParticipantSubsystem::GetAllParticipantComponents() const
+{
+	TArray<UDialogueParticipantComponent*> Comps;
+
+	Comps.Reserve(RegisteredParticipants.Num());
+
+	for (const TWeakObjectPtr<UDialogueParticipantComponent>& Participant : RegisteredParticipants)
+	{
+		if (UDialogueParticipantComponent* Comp = Participant.Get(); IsValid(Comp)) Comps.Add(Comp);
+	}
+
+	return Comps;
+}
+
+void UDialogueParticipantSubsystem::FindFirstParticipantComponentsForTags(
+	TConstArrayView<FGameplayTag> TargetParticipantTags,
+	TMap<FGameplayTag, UDialogueParticipantComponent*>& OutParticipantComponents) const
+{
+	OutParticipantComponents.Reserve(OutParticipantComponents.Num() + TargetParticipantTags.Num());
+
+	for (const FGameplayTag& TargetParticipantTag : TargetParticipantTags)
+	{
+		if (!TargetParticipantTag.IsValid() || OutParticipantComponents.Contains(TargetParticipantTag)) continue;
+
+		if (UDialogueParticipantComponent* Comp = FindFirstParticipantComponent(TargetParticipantTag))
+		{
+			OutParticipantComponents.Add(TargetParticipantTag, Comp);
+		}
+	}
+}
+
+void UDialogueParticipantSubsystem::RegisterParticipant(UDialogueParticipantComponent* InComponent)
+{
+	if (!InComponent || IndexedTags.Contains(InComponent)) return;
+
+	const FGameplayTagContainer ExpandedTags = InComponent->ParticipantTag.GetGameplayTagParents();
+
+	RegisteredParticipants.Add(InComponent);
+	IndexedTags.Add(InComponent, ExpandedTags);
+
+	AddToIndex(InComponent, ExpandedTags);
+}
+
+void UDialogueParticipantSubsystem::UnregisterParticipant(UDialogueParticipantComponent* InComponent)
+{
+	if (!InComponent) return;
+
+	FGameplayTagContainer ExpandedTags;
+
+	if (!IndexedTags.RemoveAndCopyValue(InComponent, ExpandedTags)) return;
+
+	RegisteredParticipants.Remove(InComponent);
+
+	RemoveFromIndex(InComponent, ExpandedTags);
+}
+
+void UDialogueParticipantSubsystem::NotifyParticipantTagChanged(UDialogueParticipantComponent* InComponent)
+{
+	if (!InComponent) return;
+
+	FGameplayTagContainer* OldExpandedTags = IndexedTags.Find(InComponent);
+
+	//Not registered yet - it will be indexed with its current tags when it gets registered.
+	if (!OldExpandedTags) return;
+
+	const FGameplayTagContainer NewExpandedTags = InComponent->ParticipantTag.GetGameplayTagParents();
+
+	FGameplayTagContainer RemovedTags;
+	FGameplayTagContainer AddedTags;
+
+	for (const FGameplayTag& OldTag : *OldExpandedTags)
+	{
+		if (!NewExpandedTags.HasTagExact(OldTag)) RemovedTags.AddTagFast(OldTag);
+	}
+
+	for (const FGameplayTag& NewTag : NewExpandedTags)
+	{
+		if (!OldExpandedTags->HasTagExact(NewTag)) AddedTags.AddTagFast(NewTag);
+	}
+
+	*OldExpandedTags = NewExpandedTags;
+
+	RemoveFromIndex(InComponent, RemovedTags);
+	AddToIndex(InComponent, AddedTags);
+}
+
+void UDialogueParticipantSubsystem::Deinitialize()
+{
+	ParticipantIndex.Empty();
+	RegisteredParticipants.Empty();
+	IndexedTags.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDialogueParticipantSubsystem::AddToIndex(UDialogueParticipantComponent* InComponent, const FGameplayTagContainer& InExpandedTags)
+{
+	for (const FGameplayTag& Tag : InExpandedTags)
+	{
+		ParticipantIndex.FindOrAdd(Tag).AddUnique(InComponent);
+	}
+}
+
+void UDialogueParticipantSubsystem::RemoveFromIndex(UDialogueParticipantComponent* InComponent, const FGameplayTagContainer& InExpandedTags)
+{
+	for (const FGameplayTag& Tag : InExpandedTags)
+	{
+		TArray<TWeakObjectPtr<UDialogueParticipantComponent>>* Participants = ParticipantIndex.Find(Tag);
+
+		if (!Participants) continue;
+
+		//Keep the registration order of the rest, so the 'first' participant stays stable.
+		Participants->RemoveAll([InComponent](const TWeakObjectPtr<UDialogueParticipantComponent>& Participant)
+		{
+			return Participant == InComponent || !Participant.IsValid();
+		});
+
+		if (Participants->IsEmpty()) ParticipantIndex.Remove(Tag);
+	}
+}
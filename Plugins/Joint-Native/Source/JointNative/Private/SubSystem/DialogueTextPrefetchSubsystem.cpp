@@ -0,0 +1,307 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "SubSystem/DialogueTextPrefetchSubsystem.h"
+
+#include "JointActor.h"
+#include "JointFunctionLibrary.h"
+#include "JointNativeTransliteratorPool.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Internationalization/Culture.h"
+#include "Internationalization/Internationalization.h"
+#include "Misc/ScopeLock.h"
+#include "Node/DF_Text.h"
+#include "Node/JointFragment.h"
+#include "Node/JointNodeBase.h"
+#include "TimerManager.h"
+
+using FDialogueTextCacheKey = TTuple<FGuid, FString>;
+
+struct FDialogueTextPrefetchCache
+{
+public:
+
+	bool Find(const FDialogueTextCacheKey& Key, const FString& DisplayString, const FName& Rule, FDialoguePreprocessedText& OutText)
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (const FDialoguePreprocessedText* Found = Entries.Find(Key))
+		{
+			//The text can be changed at runtime with SetText(), so make sure it is still the same text.
+			if (Found->DisplayString == DisplayString && Found->TransliterationRule == Rule)
+			{
+				OutText = *Found;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	//Returns false if the key is already cached or being processed. OutGeneration is the generation the result must be added with.
+	bool TryMarkInFlight(const FDialogueTextCacheKey& Key, const FString& DisplayString, const FName& Rule, uint32& OutGeneration)
+	{
+		FScopeLock Lock(&Mutex);
+
+		OutGeneration = Generation;
+
+		if (InFlight.Contains(Key)) return false;
+
+		if (const FDialoguePreprocessedText* Found = Entries.Find(Key))
+		{
+			if (Found->DisplayString == DisplayString && Found->TransliterationRule == Rule) return false;
+		}
+
+		InFlight.Add(Key);
+
+		return true;
+	}
+
+	uint32 GetGeneration()
+	{
+		FScopeLock Lock(&Mutex);
+
+		return Generation;
+	}
+
+	void Add(const FDialogueTextCacheKey& Key, FDialoguePreprocessedText&& InText, const int32 MaxEntries, const uint32 InGeneration)
+	{
+		FScopeLock Lock(&Mutex);
+
+		//Requested before the cache was emptied. The key may have been requested again since then, so leave its in-flight mark alone.
+		if (InGeneration != Generation) return;
+
+		InFlight.Remove(Key);
+
+		if (!Entries.Contains(Key)) Order.Add(Key);
+
+		Entries.Add(Key, MoveTemp(InText));
+
+		while (Order.Num() > FMath::Max(MaxEntries, 1))
+		{
+			Entries.Remove(Order[0]);
+			Order.RemoveAt(0, 1, false);
+		}
+	}
+
+	void Empty()
+	{
+		FScopeLock Lock(&Mutex);
+
+		Entries.Empty();
+		Order.Empty();
+
+		//The tasks in flight will discard their results, so the keys can be requested again right away.
+		InFlight.Empty();
+
+		++Generation;
+	}
+
+private:
+
+	FCriticalSection Mutex;
+
+	TMap<FDialogueTextCacheKey, FDialoguePreprocessedText> Entries;
+
+	//Insertion order of the entries, oldest first.
+	TArray<FDialogueTextCacheKey> Order;
+
+	TSet<FDialogueTextCacheKey> InFlight;
+
+	//Bumped on every Empty().
+	uint32 Generation = 0;
+
+};
+
+
+namespace DialogueTextPrefetch
+{
+	FDialogueTextCacheKey MakeKey(const UJointNodeBase* Node)
+	{
+		return FDialogueTextCacheKey(Node->GetNodeGuid(), FInternationalization::Get().GetCurrentLanguage()->GetName());
+	}
+
+	void CollectTextNodes(UJointNodeBase* Node, TArray<UJointNodeBase*>& OutTextNodes)
+	{
+		if (Node == nullptr) return;
+
+		if (Node->GetClass()->ImplementsInterface(UJN_Text_Interface::StaticClass())) OutTextNodes.Add(Node);
+
+		for (UJointFragment* Fragment : Node->GetAllFragmentsOnLowerHierarchy())
+		{
+			if (Fragment && Fragment->GetClass()->ImplementsInterface(UJN_Text_Interface::StaticClass())) OutTextNodes.Add(Fragment);
+		}
+	}
+}
+
+
+FDialoguePreprocessedText FDialoguePreprocessedText::Preprocess(const FString& InDisplayString, const FName& InTransliterationRule)
+{
+	FDialoguePreprocessedText Result;
+
+	Result.DisplayString = InDisplayString;
+	Result.TransliteratedString = InDisplayString;
+	Result.TransliterationRule = InTransliterationRule;
+
+	//Goes through the shared parse cache, so the range queries of the widgets on the same text will be a cache hit as well.
+	const TSharedRef<const FJointRichTextParseResult, ESPMode::ThreadSafe> ParseResult = UJointFunctionLibrary::GetCachedRichTextParseResult(InDisplayString);
+
+	Result.TextContentRange = ParseResult->TextContentRange;
+	Result.DecoratedTextContentRange = ParseResult->DecoratedTextContentRange;
+	Result.DecoratorSymbolRange = ParseResult->DecoratorSymbolRange;
+
+	if (!InTransliterationRule.IsNone())
+	{
+		FJointNativeTransliteratorPool::Get().Transliterate(InTransliterationRule, Result.TransliteratedString);
+	}
+
+	return Result;
+}
+
+
+UDialogueTextPrefetchSubsystem::UDialogueTextPrefetchSubsystem()
+{
+	Cache = MakeShared<FDialogueTextPrefetchCache, ESPMode::ThreadSafe>();
+}
+
+UDialogueTextPrefetchSubsystem* UDialogueTextPrefetchSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<UDialogueTextPrefetchSubsystem>();
+	}
+
+	return nullptr;
+}
+
+void UDialogueTextPrefetchSubsystem::RequestPrefetchUpcomingTexts(UJointNodeBase* FromNode)
+{
+	if (FromNode == nullptr) return;
+
+	UJointNodeBase* ParentmostNode = FromNode->GetParentmostNode();
+
+	if (ParentmostNode == nullptr) return;
+
+	PendingPrefetchRequests.AddUnique(ParentmostNode);
+
+	if (bPrefetchScheduled) return;
+
+	//Batch the requests from the fragments of the same node that begin play on this frame.
+	if (UWorld* World = GetWorld())
+	{
+		bPrefetchScheduled = true;
+
+		World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UDialogueTextPrefetchSubsystem::ProcessPendingPrefetchRequests));
+	}
+}
+
+void UDialogueTextPrefetchSubsystem::ProcessPendingPrefetchRequests()
+{
+	bPrefetchScheduled = false;
+
+	TArray<TWeakObjectPtr<UJointNodeBase>> Requests = MoveTemp(PendingPrefetchRequests);
+
+	PendingPrefetchRequests.Reset();
+
+	for (const TWeakObjectPtr<UJointNodeBase>& Request : Requests)
+	{
+		UJointNodeBase* Node = Request.Get();
+
+		if (Node == nullptr || Node->IsNodeEndedPlay()) continue;
+
+		//Don't run the selection logic ahead of time - it can have side effects on the nodes. Look at every node the node can possibly move to instead.
+		TArray<UJointNodeBase*> Candidates;
+
+		Node->GetPossibleNextNodes(Candidates);
+
+		for (UJointNodeBase* Candidate : Candidates)
+		{
+			PrefetchTextsOnNode(Candidate);
+		}
+	}
+}
+
+void UDialogueTextPrefetchSubsystem::PrefetchTextsOnNode(UJointNodeBase* Node)
+{
+	if (Node == nullptr || !Cache.IsValid()) return;
+
+	TArray<UJointNodeBase*> TextNodes;
+
+	DialogueTextPrefetch::CollectTextNodes(Node, TextNodes);
+
+	if (TextNodes.IsEmpty()) return;
+
+	//Gather the display strings on the game thread, the texts can be provided by the blueprint implementations.
+	TArray<TTuple<FDialogueTextCacheKey, FString>> Jobs;
+
+	uint32 Generation = 0;
+
+	for (UJointNodeBase* TextNode : TextNodes)
+	{
+		const FDialogueTextCacheKey Key = DialogueTextPrefetch::MakeKey(TextNode);
+
+		FString DisplayString = IJN_Text_Interface::Execute_GetText(TextNode).ToString();
+
+		if (!Cache->TryMarkInFlight(Key, DisplayString, TransliterationRule, Generation)) continue;
+
+		Jobs.Emplace(Key, MoveTemp(DisplayString));
+	}
+
+	if (Jobs.IsEmpty()) return;
+
+	Async(EAsyncExecution::ThreadPool, [WeakCache = TWeakPtr<FDialogueTextPrefetchCache, ESPMode::ThreadSafe>(Cache), Jobs = MoveTemp(Jobs), Rule = TransliterationRule, MaxEntries = MaxCachedTexts, Generation]()
+	{
+		for (const TTuple<FDialogueTextCacheKey, FString>& Job : Jobs)
+		{
+			FDialoguePreprocessedText Result = FDialoguePreprocessedText::Preprocess(Job.Get<1>(), Rule);
+
+			if (const TSharedPtr<FDialogueTextPrefetchCache, ESPMode::ThreadSafe> PinnedCache = WeakCache.Pin())
+			{
+				PinnedCache->Add(Job.Get<0>(), MoveTemp(Result), MaxEntries, Generation);
+			}
+		}
+	});
+}
+
+bool UDialogueTextPrefetchSubsystem::GetPreprocessedText(UJointNodeBase* TextNode, FDialoguePreprocessedText& OutPreprocessedText)
+{
+	if (TextNode == nullptr || !Cache.IsValid() || !TextNode->GetClass()->ImplementsInterface(UJN_Text_Interface::StaticClass())) return false;
+
+	const FDialogueTextCacheKey Key = DialogueTextPrefetch::MakeKey(TextNode);
+
+	const FString DisplayString = IJN_Text_Interface::Execute_GetText(TextNode).ToString();
+
+	if (Cache->Find(Key, DisplayString, TransliterationRule, OutPreprocessedText)) return true;
+
+	//Cache miss - preprocess it right away.
+	OutPreprocessedText = FDialoguePreprocessedText::Preprocess(DisplayString, TransliterationRule);
+
+	Cache->Add(Key, FDialoguePreprocessedText(OutPreprocessedText), MaxCachedTexts, Cache->GetGeneration());
+
+	return false;
+}
+
+void UDialogueTextPrefetchSubsystem::ClearCache()
+{
+	if (Cache.IsValid()) Cache->Empty();
+}
+
+void UDialogueTextPrefetchSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	PendingPrefetchRequests.Empty();
+
+	//Drop our reference. The worker tasks that are still running will see the cache gone and discard their results.
+	Cache.Reset();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,209 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "SubSystem/LevelSequencePlayerPoolSubsystem.h"
+
+#include "JointNativeSettings.h"
+
+#include "LevelSequence.h"
+#include "LevelSequenceActor.h"
+#include "LevelSequencePlayer.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+void ULevelSequencePlayerPoolListener::BindToActor(ALevelSequenceActor* InActor)
+{
+	UnbindFromActor();
+
+	Actor = InActor;
+
+	if (ULevelSequencePlayer* Player = Actor ? Actor->GetSequencePlayer() : nullptr)
+	{
+		Player->OnFinished.AddUniqueDynamic(this, &ULevelSequencePlayerPoolListener::OnPlayerFinished);
+		Player->OnStop.AddUniqueDynamic(this, &ULevelSequencePlayerPoolListener::OnPlayerStopped);
+	}
+}
+
+void ULevelSequencePlayerPoolListener::UnbindFromActor()
+{
+	if (ULevelSequencePlayer* Player = IsValid(Actor) ? Actor->GetSequencePlayer() : nullptr)
+	{
+		Player->OnFinished.RemoveDynamic(this, &ULevelSequencePlayerPoolListener::OnPlayerFinished);
+		Player->OnStop.RemoveDynamic(this, &ULevelSequencePlayerPoolListener::OnPlayerStopped);
+	}
+
+	Actor = nullptr;
+}
+
+void ULevelSequencePlayerPoolListener::OnPlayerFinished()
+{
+	if (ULevelSequencePlayerPoolSubsystem* Pool = Cast<ULevelSequencePlayerPoolSubsystem>(GetOuter())) Pool->ScheduleRelease(Actor);
+}
+
+void ULevelSequencePlayerPoolListener::OnPlayerStopped()
+{
+	if (ULevelSequencePlayerPoolSubsystem* Pool = Cast<ULevelSequencePlayerPoolSubsystem>(GetOuter())) Pool->ScheduleRelease(Actor);
+}
+
+ULevelSequencePlayerPoolSubsystem* ULevelSequencePlayerPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject) return nullptr;
+
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetSubsystem<ULevelSequencePlayerPoolSubsystem>();
+	}
+
+	return nullptr;
+}
+
+ALevelSequenceActor* ULevelSequencePlayerPoolSubsystem::AcquireLevelSequenceActor(ULevelSequence* Sequence, const FMovieSceneSequencePlaybackSettings& Settings)
+{
+	if (Sequence == nullptr) return nullptr;
+
+	ALevelSequenceActor* Actor = nullptr;
+
+	while (!IdleActors.IsEmpty() && Actor == nullptr)
+	{
+		ALevelSequenceActor* IdleActor = IdleActors.Pop(false);
+
+		if (IsValid(IdleActor) && IdleActor->GetSequencePlayer()) Actor = IdleActor;
+	}
+
+	const bool bReusingIdleActor = Actor != nullptr;
+
+	if (bReusingIdleActor)
+	{
+		//Rebind the actor. The player will be initialized again with the new settings on SetSequence().
+		Actor->PlaybackSettings = Settings;
+		Actor->SetSequence(Sequence);
+	}
+	else
+	{
+		//Spawned actors start playing on their BeginPlay if the settings have bAutoPlay.
+		ULevelSequencePlayer::CreateLevelSequencePlayer(this, Sequence, Settings, Actor);
+	}
+
+	if (Actor == nullptr) return nullptr;
+
+	//Bind the listener before playing, so the actor can't finish without us knowing it.
+	ULevelSequencePlayerPoolListener* Listener = NewObject<ULevelSequencePlayerPoolListener>(this);
+	Listener->BindToActor(Actor);
+
+	ActiveActors.Add(Actor, Listener);
+
+	if (bReusingIdleActor && Settings.bAutoPlay)
+	{
+		if (ULevelSequencePlayer* Player = Actor->GetSequencePlayer()) Player->Play();
+	}
+
+	return Actor;
+}
+
+void ULevelSequencePlayerPoolSubsystem::ReleaseLevelSequenceActor(ALevelSequenceActor* Actor)
+{
+	if (Actor == nullptr) return;
+
+	TObjectPtr<ULevelSequencePlayerPoolListener> Listener = nullptr;
+
+	if (!ActiveActors.RemoveAndCopyValue(Actor, Listener)) return;
+
+	//Unbind first, so stopping the player below doesn't schedule another release.
+	if (Listener) Listener->UnbindFromActor();
+
+	if (!IsValid(Actor)) return;
+
+	if (ULevelSequencePlayer* Player = Actor->GetSequencePlayer())
+	{
+		if (Player->IsPlaying() || Player->IsPaused()) Player->Stop();
+	}
+
+	const UJointNativeSettings* Settings = UJointNativeSettings::Get();
+
+	if (IdleActors.Num() >= (Settings ? Settings->LevelSequencePoolMaxSize : 0))
+	{
+		Actor->Destroy();
+
+		return;
+	}
+
+	Actor->ResetBindings();
+
+	IdleActors.Add(Actor);
+}
+
+void ULevelSequencePlayerPoolSubsystem::EmptyPool()
+{
+	for (ALevelSequenceActor* IdleActor : IdleActors)
+	{
+		if (IsValid(IdleActor)) IdleActor->Destroy();
+	}
+
+	IdleActors.Empty();
+}
+
+void ULevelSequencePlayerPoolSubsystem::ScheduleRelease(ALevelSequenceActor* Actor)
+{
+	if (Actor == nullptr || !ActiveActors.Contains(Actor)) return;
+
+	const bool bAlreadyScheduled = !ScheduledReleases.IsEmpty();
+
+	ScheduledReleases.AddUnique(Actor);
+
+	if (bAlreadyScheduled) return;
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &ULevelSequencePlayerPoolSubsystem::ReleaseScheduledActors));
+	}
+}
+
+void ULevelSequencePlayerPoolSubsystem::ReleaseScheduledActors()
+{
+	TArray<TWeakObjectPtr<ALevelSequenceActor>> ActorsToRelease = MoveTemp(ScheduledReleases);
+
+	ScheduledReleases.Reset();
+
+	for (const TWeakObjectPtr<ALevelSequenceActor>& ActorToRelease : ActorsToRelease)
+	{
+		ALevelSequenceActor* Actor = ActorToRelease.Get();
+
+		//The actor might have been played again by its user since then. Leave it alone in that case.
+		const ULevelSequencePlayer* Player = Actor ? Actor->GetSequencePlayer() : nullptr;
+
+		if (Player && Player->IsPlaying()) continue;
+
+		ReleaseLevelSequenceActor(Actor);
+	}
+
+	//Drop the actors that have been destroyed by someone else while they were active.
+	for (auto It = ActiveActors.CreateIterator(); It; ++It)
+	{
+		if (IsValid(It.Key())) continue;
+
+		if (It.Value()) It.Value()->UnbindFromActor();
+
+		It.RemoveCurrent();
+	}
+}
+
+void ULevelSequencePlayerPoolSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	for (const TPair<TObjectPtr<ALevelSequenceActor>, TObjectPtr<ULevelSequencePlayerPoolListener>>& ActiveActor : ActiveActors)
+	{
+		if (ActiveActor.Value) ActiveActor.Value->UnbindFromActor();
+	}
+
+	//The actors themselves go away with the world.
+	IdleActors.Empty();
+	ActiveActors.Empty();
+	ScheduledReleases.Empty();
+
+	Super::Deinitialize();
+}
@@ -8,8 +8,11 @@
 #include "DialogueParticipantComponent.generated.h"
 
 class UDialogueParticipantModuleItem;
+class UDialogueParticipantComponent;
 class UJointManager;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnParticipantTagChanged, UDialogueParticipantComponent*, ParticipantComponent, const FGameplayTagContainer&, OldTags, const FGameplayTagContainer&, NewTags);
+
 /**
  * Important Note for the all users and SDS1 users.
  * Additional functionalities must be implemented with additional components.
@@ -42,10 +45,49 @@ public:
 	 * Tag of this participant that will be used on the dialogue.
 	 * You can access this component in the dialogue by searching it with its ParticipantTag.
 	 * Note for the SDS1 users : it's a new version of IDName in SDS2.
+	 *
+	 * Joint Native 1.16: Participants are indexed by this tag on the world's UDialogueParticipantSubsystem.
+	 * Change it with SetParticipantTags(), AddParticipantTag() or RemoveParticipantTag() at runtime to keep the index up to date. (Blueprint setter nodes are routed to SetParticipantTags() automatically.)
 	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SpeechBubble")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter=SetParticipantTags, Category = "SpeechBubble")
 		FGameplayTagContainer ParticipantTag;
 
+public:
+
+	/**
+	 * Replace the participant tags of this component.
+	 * @param NewTags The new participant tags.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintSetter, Category="Dialogue Participant Component")
+	void SetParticipantTags(const FGameplayTagContainer& NewTags);
+
+	/**
+	 * Add a participant tag to this component.
+	 * @param TagToAdd The participant tag to add.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Dialogue Participant Component")
+	void AddParticipantTag(const FGameplayTag& TagToAdd);
+
+	/**
+	 * Remove a participant tag from this component.
+	 * @param TagToRemove The participant tag to remove.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Dialogue Participant Component")
+	void RemoveParticipantTag(const FGameplayTag& TagToRemove);
+
+public:
+
+	/**
+	 * Called when the participant tags of this component have been changed through the tag API.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="Dialogue Participant Component")
+	FOnParticipantTagChanged OnParticipantTagChanged;
+
+private:
+
+	//Update the participant index of the world and broadcast the change.
+	void NotifyParticipantTagChanged(const FGameplayTagContainer& OldTags);
+
 public:
 
 	/**
@@ -105,6 +147,12 @@ private:
 	UFUNCTION()
 	void OnRep_CachedParticipantModulesForNetworking(const TArray<UDialogueParticipantModuleItem*>& PreviousCache);
 	
+public:
+
+	virtual void OnRegister() override;
+
+	virtual void OnUnregister() override;
+
 private:
 	
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
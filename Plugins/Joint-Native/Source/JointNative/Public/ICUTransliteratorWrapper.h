@@ -88,6 +88,14 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Transliteration")
 	FString TransliterateString(const FString Str);
 
+	/**
+	 * Transliterate all the provided strings at once. See TransliterateString() for the details.
+	 * @param Strs The strings to transliterate.
+	 * @return Transliterated strings, in the same order.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Transliteration")
+	TArray<FString> TransliterateStrings(const TArray<FString>& Strs);
+
 public:
 	
 	/**
@@ -98,6 +106,7 @@ public:
 
 	/**
 	 * Create transliterator instance with the provided transform rule. check out possible rules for the system. https://icu4c-demos.unicode.org/icu-bin/translit (ICU official)
+	 * Joint Native 1.16: The instance is cloned from the rule's compiled transliterator on FJointNativeTransliteratorPool, so the rule will be compiled only once.
 	 * @param TransformRule TransformRule for the transliterator.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Transliteration")
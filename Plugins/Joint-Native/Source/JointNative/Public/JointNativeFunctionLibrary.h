@@ -9,6 +9,7 @@
 
 class UWidget;
 class UICUTransliteratorWrapper;
+class UJointNodeBase;
 
 /**
  * Joint Native's BP function library that helps you to do everything in BP side without messing with the crazy c++.
@@ -54,6 +55,20 @@ public:
 		UObject* WorldContextObject
 	);
 
+	/**
+	 * Resolve the participant components of all the speakers and listeners (UDF_SpeakerAndListener) on the provided node and its fragments in a single pass.
+	 * Participants that don't have their component instance yet will be resolved with their participant tags at once, without assigning the found component to the participant.
+	 * @param Node The node to resolve the speakers and listeners of.
+	 * @param OutSpeakers Participant components of the speakers.
+	 * @param OutListeners Participant components of the listeners.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue")
+	static void ResolveSpeakersAndListeners(
+		UJointNodeBase* Node,
+		TArray<class UDialogueParticipantComponent*>& OutSpeakers,
+		TArray<class UDialogueParticipantComponent*>& OutListeners
+	);
+
 public:
 	
 	UFUNCTION(BlueprintCallable, Category = "Projection", meta=(WorldContext="WorldContextObject"))
@@ -86,6 +101,27 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Transliteration")
 	static UICUTransliteratorWrapper* CreateTransliterator(const FName TransformRule);
 
+	/**
+	 * Transliterate a string with the provided transform rule, without creating a transliterator wrapper.
+	 * The compiled transliterators are cached per rule and shared across the calls (and threads), so it's cheap to call this for every line.
+	 * See CreateTransliterator() for the requirements of the transliteration.
+	 * @param TransformRule Transform rule for the transliterator.
+	 * @param Str The string to transliterate.
+	 * @return Transliterated string. The original string if the transliterator is not available.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Transliteration")
+	static FString TransliterateString(const FName TransformRule, const FString& Str);
+
+	/**
+	 * Transliterate all the provided strings with the provided transform rule in one call.
+	 * See TransliterateString() for the details.
+	 * @param TransformRule Transform rule for the transliterator.
+	 * @param Strs The strings to transliterate.
+	 * @return Transliterated strings, in the same order.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Transliteration")
+	static TArray<FString> TransliterateStrings(const FName TransformRule, const TArray<FString>& Strs);
+
 	/**
 	 * Print the list of possible cultures that can be used on the transliteration. It can be changed from each stage of the project and project settings, so please check this out before you proceed to publish it.
 	 * @return log for the ids.
@@ -0,0 +1,6 @@
+﻿#pragma once
+
+#include "Logging/LogMacros.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogJointNative, Log, All);
+
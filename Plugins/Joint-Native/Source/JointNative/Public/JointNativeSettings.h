@@ -0,0 +1,50 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+
+#include "JointNativeSettings.generated.h"
+
+/**
+ * The Developer Settings class that holds the project wide data for Joint Native.
+ * Joint Native 1.16: Introduced.
+ */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "Joint Native Settings"))
+class JOINTNATIVE_API UJointNativeSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	UJointNativeSettings();
+
+public:
+
+	/**
+	 * The maximum number of the idle level sequence actors the level sequence player pool (ULevelSequencePlayerPoolSubsystem) keeps per world.
+	 * The number of the actors that are playing at the same time is not limited by this.
+	 */
+	UPROPERTY(config, EditAnywhere, Category="Level Sequence Pool", meta = (ClampMin = 0))
+	int32 LevelSequencePoolMaxSize = 8;
+
+public:
+
+	/**
+	 * Get the singleton instance of the class.
+	 * @return The singleton instance of UJointNativeSettings.
+	 */
+	static UJointNativeSettings* Get();
+
+public:
+
+	virtual FName GetCategoryName() const override final { return TEXT("Joint"); }
+
+#if WITH_EDITOR
+
+	virtual FText GetSectionText() const override final { return FText::FromString("Joint Native Preferences"); }
+
+#endif
+
+};
@@ -0,0 +1,121 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if UE_ENABLE_ICU
+#define SAVED_TRANSLITERATION UCONFIG_NO_TRANSLITERATION
+#undef UCONFIG_NO_TRANSLITERATION
+#define UCONFIG_NO_TRANSLITERATION 0
+THIRD_PARTY_INCLUDES_START
+#include <unicode/translit.h>
+#include <unicode/utrans.h>
+THIRD_PARTY_INCLUDES_END
+#endif
+
+struct FJointNativeTransliteratorPoolEntry;
+
+/**
+ * A process-wide, thread-safe cache of the compiled ICU transliterators, keyed by the transform rule.
+ *
+ * Creating an ICU transliterator compiles its rule set, which is far more expensive than the transliteration itself.
+ * The pool compiles each rule only once, and hands out clones of the compiled transliterator to the callers so that several threads can transliterate with the same rule at once.
+ * The strings are converted between TCHAR and ICU's UTF-16 buffers directly, without going through UTF-8.
+ * The latest results are kept as well, so a line that has been transliterated ahead of time (e.g. by UDialogueTextPrefetchSubsystem on a worker thread) is a cache hit when it is displayed.
+ *
+ * Joint Native 1.16: Introduced to stop recompiling the transliterator for every displayed line.
+ */
+class JOINTNATIVE_API FJointNativeTransliteratorPool
+{
+public:
+
+	static FJointNativeTransliteratorPool& Get();
+
+public:
+
+	/**
+	 * Transliterate a string with the provided transform rule.
+	 * @param TransformRule Transform rule for the transliterator.
+	 * @param InOutString The string to transliterate. It will be left untouched if the transliterator is not available.
+	 * @return Whether the string has been transliterated.
+	 */
+	bool Transliterate(const FName& TransformRule, FString& InOutString);
+
+	/**
+	 * Transliterate all the provided strings with the provided transform rule, with a single transliterator acquisition.
+	 * @param TransformRule Transform rule for the transliterator.
+	 * @param InOutStrings The strings to transliterate. They will be left untouched if the transliterator is not available.
+	 * @return Whether the strings have been transliterated.
+	 */
+	bool TransliterateStrings(const FName& TransformRule, TArrayView<FString> InOutStrings);
+
+	/**
+	 * Check whether the transliterator for the provided transform rule can be created on this system.
+	 */
+	bool IsRuleAvailable(const FName& TransformRule);
+
+	/**
+	 * Find the result of an earlier transliteration of the provided string with the provided transform rule.
+	 * @return Whether the result was cached.
+	 */
+	bool FindCachedResult(const FName& TransformRule, const FString& Source, FString& OutResult);
+
+public:
+
+#if UE_ENABLE_ICU
+
+	/**
+	 * Create a new transliterator instance that is a clone of the cached one for the rule.
+	 * The caller owns the returned object and must delete it. Returns nullptr if the rule is not available.
+	 */
+	icu::Transliterator* CloneTransliterator(const FName& TransformRule);
+
+public:
+
+	/**
+	 * Copy the TCHAR buffer of the string into the UTF-16 buffer of the unicode string. The unicode string's buffer will be reused if it has enough capacity.
+	 */
+	static void ConvertString(const FString& Source, icu::UnicodeString& Destination);
+
+	/**
+	 * Copy the UTF-16 buffer of the unicode string into the TCHAR buffer of the string.
+	 */
+	static void ConvertString(const icu::UnicodeString& Source, FString& Destination);
+
+#endif
+
+	/**
+	 * Release all the cached transliterators and results. Must be called before ICU is shut down.
+	 */
+	void Reset();
+
+private:
+
+	TSharedPtr<FJointNativeTransliteratorPoolEntry> FindOrCreateEntry(const FName& TransformRule);
+
+	void CacheResult(const FName& TransformRule, const FString& Source, const FString& Result);
+
+private:
+
+	FCriticalSection EntriesMutex;
+
+	TMap<FName, TSharedPtr<FJointNativeTransliteratorPoolEntry>> Entries;
+
+private:
+
+	FCriticalSection ResultsMutex;
+
+	TMap<TPair<FName, FString>, FString> Results;
+
+	//Insertion order of the results, oldest first.
+	TArray<TPair<FName, FString>> ResultOrder;
+
+};
+
+#if UE_ENABLE_ICU
+#define SAVED_TRANSLITERATION UCONFIG_NO_TRANSLITERATION
+#undef UCONFIG_NO_TRANSLITERATION
+#define UCONFIG_NO_TRANSLITERATION SAVED_TRANSLITERATION
+#undef SAVED_TRANSLITERATION
+#endif
@@ -51,7 +51,7 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Branch Control")
 	bool bUseFalse = true;
 	
-public:
+protected:
 	
-	virtual TArray<UJointNodeBase*> SelectNextNodes_Implementation(AJointActor* InHostingDialogueInstance) override;
+	virtual bool NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes) override;
 };
@@ -53,7 +53,7 @@ public:
 private:
 	
 	// Whether this node is already broken.
- 	UPROPERTY(Transient)
+ 	UPROPERTY(Transient, SaveGame)
 	bool bIsBroken = false;
 
 public:
@@ -63,9 +63,9 @@ public:
 	virtual void PostNodeBeginPlay_Implementation() override;
 	virtual const FJointEdPinConnectionResponse CanAttachThisAtParentNode_Implementation(const UObject* InParentNode) const override;
 	
-public:
+protected:
 	
-	virtual TArray<UJointNodeBase*> SelectNextNodes_Implementation(AJointActor* InHostingJointInstance) override;
+	virtual bool NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes) override;
 	
 public:
 	
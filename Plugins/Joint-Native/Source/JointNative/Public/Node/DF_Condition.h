@@ -28,12 +28,14 @@ public:
 	 * Access this value and change it to control the result of the condition check.
 	 * If this value become false, then it will cancel the iteration.
 	 */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category="Condition")
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, SaveGame, Category="Condition")
 	bool bConditionResult = true;
 
 public:
 	virtual void PostNodeBeginPlay_Implementation() override;
 
+	virtual void PostNodeProgressRestored_Implementation() override;
+
 	UFUNCTION()
 	void OnSubNodePending(UJointNodeBase* InNode);
 
@@ -42,6 +44,6 @@ public:
 
 	void PlayNextSubNode();
 
-	UPROPERTY()
+	UPROPERTY(SaveGame)
 	int CurrentIndex = INDEX_NONE;
 };
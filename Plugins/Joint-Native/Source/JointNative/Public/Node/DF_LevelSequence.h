@@ -42,6 +42,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Data")
 	bool bLoadAsync = true;
 
+	/**
+	 * Whether to get the level sequence actor from the world's level sequence player pool (ULevelSequencePlayerPoolSubsystem) instead of spawning a new one.
+	 * The pooled actor returns to the pool when its playback finishes or gets stopped, so don't hold on to CreatedLevelSequenceActor after that.
+	 * If the playback settings have bPauseAtEnd, the actor stays paused until you call ReleaseLevelSequenceActor().
+	 * Joint Native 1.16: Introduced.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Data")
+	bool bUsePooledActor = false;
+
 public:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category="Data", Transient)
@@ -53,4 +62,12 @@ public:
 
 	UFUNCTION()
 	void ExecuteAction();
+
+	/**
+	 * Return CreatedLevelSequenceActor to the level sequence player pool and clear it.
+	 * Use this to return an actor that has paused at the end. Does nothing if the actor has not been acquired from the pool.
+	 * Joint Native 1.16: Introduced.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Level Sequence Pool")
+	void ReleaseLevelSequenceActor();
 };
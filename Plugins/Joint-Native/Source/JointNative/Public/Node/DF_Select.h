@@ -33,8 +33,10 @@ public:
 public:
 
 	virtual void PostNodeBeginPlay_Implementation() override;
+
+protected:
 	
-	virtual TArray<UJointNodeBase*> SelectNextNodes_Implementation(AJointActor* InHostingDialogueInstance) override;
+	virtual bool NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes) override;
 
 public:
 
@@ -55,7 +57,7 @@ private:
 	 * Whether this node is selected by the system.
 	 * Change this value to true to let it return the nodes connected to it as the next nodes to play.
 	 */
-	UPROPERTY(EditAnywhere, Category="Select")
+	UPROPERTY(EditAnywhere, SaveGame, Category="Select")
 	bool bIsSelected = false;
 
 public:
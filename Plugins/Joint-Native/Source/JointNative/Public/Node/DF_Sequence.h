@@ -28,11 +28,13 @@ public:
 
 	virtual void PostNodeBeginPlay_Implementation() override;
 
+	virtual void PostNodeProgressRestored_Implementation() override;
+
 public:
 
 	UFUNCTION()
 	void OnSubNodePending(UJointNodeBase* InNode);
 
-	UPROPERTY()
+	UPROPERTY(SaveGame)
 	int CurrentIndex = INDEX_NONE;
 };
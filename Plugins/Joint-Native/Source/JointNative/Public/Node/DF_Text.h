@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Node/JointFragment.h"
+#include "SubSystem/DialogueTextPrefetchSubsystem.h"
 
 #include "DF_Text.generated.h"
 
@@ -91,6 +92,30 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Text")
 	FJointNodePointer TextStyleInstance;
 
+public:
+
+	/**
+	 * Whether to prefetch the texts of the upcoming nodes when this fragment begins play.
+	 * The texts will be preprocessed on a worker thread, and GetPreprocessedText() of the upcoming text fragments will be a cache hit.
+	 * Joint Native 1.16: Added.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Text|Prefetch")
+	bool bPrefetchUpcomingTexts = false;
+
+public:
+
+	virtual void PostNodeBeginPlay_Implementation() override;
+
+public:
+
+	/**
+	 * Get the text preprocessed for the display: the display string, its transliteration and its rich text ranges.
+	 * Uses the result the prefetch has made ahead of time if there is any, and preprocesses the text right away only on a cache miss.
+	 * Joint Native 1.16: Added.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Text|Prefetch")
+	FDialoguePreprocessedText GetPreprocessedText();
+
 public:
 	
 	virtual const FText GetText_Implementation() const override;
@@ -0,0 +1,115 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DialogueParticipantSubsystem.generated.h"
+
+class UDialogueParticipantComponent;
+
+/**
+ * A world subsystem that keeps an index of the participant components in the world by their participant tags.
+ * Participant components register themselves on this subsystem when they get registered on the world, and every tag mutation through UDialogueParticipantComponent's tag API updates the index incrementally.
+ *
+ * Each component is indexed under its tags and all of their parent tags, so a lookup for "A" will find the components that have "A.B" - the same result as FGameplayTagContainer::HasTag().
+ *
+ * Joint Native 1.16: Introduced to replace the TObjectIterator based participant lookup, which scanned every participant component in the process on every query.
+ */
+UCLASS()
+class JOINTNATIVE_API UDialogueParticipantSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Get the participant subsystem of the world the provided object is in.
+	 * @param WorldContextObject An object that this function will grab the world from.
+	 * @return The subsystem for the world. nullptr if the world is not available.
+	 */
+	static UDialogueParticipantSubsystem* Get(const UObject* WorldContextObject);
+
+public:
+
+	/**
+	 * Find and return the first participant component that has the given participant tag.
+	 * @param TargetParticipantTag The participant tag to look for.
+	 * @return Found participant component. nullptr if not present.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue")
+	UDialogueParticipantComponent* FindFirstParticipantComponent(const FGameplayTag& TargetParticipantTag) const;
+
+	/**
+	 * Find and return all the participant components that have the given participant tag.
+	 * @param TargetParticipantTag The participant tag to look for.
+	 * @return An array of found participant components.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue")
+	TArray<UDialogueParticipantComponent*> FindParticipantComponents(const FGameplayTag& TargetParticipantTag) const;
+
+	/**
+	 * Get all the participant components registered on this world.
+	 * @return An array of the registered participant components.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue")
+	TArray<UDialogueParticipantComponent*> GetAllParticipantComponents() const;
+
+	/**
+	 * Resolve the first participant component for each of the provided tags in a single pass over the index.
+	 * Tags that couldn't be resolved will not be added to the map.
+	 * @param TargetParticipantTags The participant tags to look for.
+	 * @param OutParticipantComponents Tag to the found participant component.
+	 */
+	void FindFirstParticipantComponentsForTags(
+		TConstArrayView<FGameplayTag> TargetParticipantTags,
+		TMap<FGameplayTag, UDialogueParticipantComponent*>& OutParticipantComponents) const;
+
+public:
+
+	/**
+	 * Register a participant component on the index. Called by the component itself on OnRegister().
+	 */
+	void RegisterParticipant(UDialogueParticipantComponent* InComponent);
+
+	/**
+	 * Unregister a participant component from the index. Called by the component itself on OnUnregister().
+	 */
+	void UnregisterParticipant(UDialogueParticipantComponent* InComponent);
+
+	/**
+	 * Update the index for the current participant tags of a registered participant component.
+	 * Only the difference between the indexed tags and the current tags will be touched.
+	 * @param InComponent The component that has changed its tags.
+	 */
+	void NotifyParticipantTagChanged(UDialogueParticipantComponent* InComponent);
+
+public:
+
+	virtual void Deinitialize() override;
+
+private:
+
+	void AddToIndex(UDialogueParticipantComponent* InComponent, const FGameplayTagContainer& InExpandedTags);
+
+	void RemoveFromIndex(UDialogueParticipantComponent* InComponent, const FGameplayTagContainer& InExpandedTags);
+
+private:
+
+	/**
+	 * Tag (including the parent tags of the participant tags) to the participant components that have it.
+	 */
+	TMap<FGameplayTag, TArray<TWeakObjectPtr<UDialogueParticipantComponent>>> ParticipantIndex;
+
+	/**
+	 * All the participant components registered on this world, in the order of the registration.
+	 */
+	TArray<TWeakObjectPtr<UDialogueParticipantComponent>> RegisteredParticipants;
+
+	/**
+	 * The expanded tags each registered component has been indexed with. Used to diff the tags on the change, and to unindex the component even if its tags were modified without notifying.
+	 */
+	TMap<TWeakObjectPtr<UDialogueParticipantComponent>, FGameplayTagContainer> IndexedTags;
+
+};
@@ -0,0 +1,162 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DialogueTextPrefetchSubsystem.generated.h"
+
+class UJointNodeBase;
+struct FDialogueTextPrefetchCache;
+
+/**
+ * A text that has been preprocessed for the display: the resolved display string, its rich text ranges and its transliteration.
+ */
+USTRUCT(BlueprintType)
+struct JOINTNATIVE_API FDialoguePreprocessedText
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * The display string of the text. (FText::ToString(), with the format arguments and the localization resolved)
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Preprocessed Text")
+	FString DisplayString;
+
+	/**
+	 * The transliterated display string. Same as the display string if there was no transliteration rule.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Preprocessed Text")
+	FString TransliteratedString;
+
+	/**
+	 * The transliteration rule the TransliteratedString has been produced with.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Preprocessed Text")
+	FName TransliterationRule = NAME_None;
+
+	/**
+	 * Same as UJointFunctionLibrary::GetTextContentRange() of the text.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Preprocessed Text")
+	TArray<FInt32Range> TextContentRange;
+
+	/**
+	 * Same as UJointFunctionLibrary::GetDecoratedTextContentRange() of the text.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Preprocessed Text")
+	TArray<FInt32Range> DecoratedTextContentRange;
+
+	/**
+	 * Same as UJointFunctionLibrary::GetDecoratorSymbolRange() of the text.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Preprocessed Text")
+	TArray<FInt32Range> DecoratorSymbolRange;
+
+public:
+
+	/**
+	 * Preprocess the provided display string. This doesn't touch any UObject, so it can be called from any thread.
+	 */
+	static FDialoguePreprocessedText Preprocess(const FString& InDisplayString, const FName& InTransliterationRule);
+
+};
+
+
+/**
+ * A world subsystem that preprocesses the texts of the upcoming dialogue lines on a worker thread, so displaying them will be a cache hit.
+ *
+ * When a text fragment begins play, the subsystem looks ahead at the nodes its node can move to (UJointNodeBase::GetPossibleNextNodes(), which doesn't run any selection logic) on the next tick,
+ * and preprocesses the texts (IJN_Text_Interface) on them: transliteration, rich text markup ranges, and the display string.
+ * The results are stored in a small cache keyed by the node Guid and the current culture, and read by the display path through GetPreprocessedText().
+ * The transliterations are also kept by FJointNativeTransliteratorPool, so the widgets that transliterate the same line on the display get the prefetched result as well.
+ *
+ * Joint Native 1.16: Introduced to move the text preprocessing off the game thread.
+ */
+UCLASS()
+class JOINTNATIVE_API UDialogueTextPrefetchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	UDialogueTextPrefetchSubsystem();
+
+public:
+
+	/**
+	 * Get the text prefetch subsystem of the world the provided object is in.
+	 * @param WorldContextObject An object that this function will grab the world from.
+	 * @return The subsystem for the world. nullptr if the world is not available.
+	 */
+	static UDialogueTextPrefetchSubsystem* Get(const UObject* WorldContextObject);
+
+public:
+
+	/**
+	 * Request a prefetch of the texts on the nodes the provided node can move to. The prefetch will happen on the next tick, once per node.
+	 * @param FromNode The node (or any fragment of it) to look ahead from.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Text Prefetch")
+	void RequestPrefetchUpcomingTexts(UJointNodeBase* FromNode);
+
+	/**
+	 * Preprocess the texts on the provided node and its fragments on a worker thread, if they are not cached yet.
+	 * @param Node The node to preprocess the texts of.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Text Prefetch")
+	void PrefetchTextsOnNode(UJointNodeBase* Node);
+
+	/**
+	 * Get the preprocessed text of the provided text node (IJN_Text_Interface) for the display. If it is not in the cache yet, it will be preprocessed right away on the calling thread and cached.
+	 * See UDF_Text::GetPreprocessedText().
+	 * @param TextNode The node that implements IJN_Text_Interface.
+	 * @param OutPreprocessedText The preprocessed text.
+	 * @return Whether the result came from the cache.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Text Prefetch")
+	bool GetPreprocessedText(UJointNodeBase* TextNode, FDialoguePreprocessedText& OutPreprocessedText);
+
+	/**
+	 * Remove all the cached texts.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dialogue Text Prefetch")
+	void ClearCache();
+
+public:
+
+	/**
+	 * The transliteration rule to preprocess the texts with. If None, the texts will not be transliterated.
+	 * Changing this will not invalidate the cache, but the entries made with the other rule will be treated as a miss.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Dialogue Text Prefetch")
+	FName TransliterationRule = NAME_None;
+
+	/**
+	 * The maximum number of the cached texts. The oldest entries will be removed first.
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Dialogue Text Prefetch")
+	int32 MaxCachedTexts = 64;
+
+public:
+
+	virtual void Deinitialize() override;
+
+private:
+
+	void ProcessPendingPrefetchRequests();
+
+private:
+
+	TArray<TWeakObjectPtr<UJointNodeBase>> PendingPrefetchRequests;
+
+	bool bPrefetchScheduled = false;
+
+	/**
+	 * Shared with the worker tasks, so the tasks that finish after the subsystem has been destroyed will not touch a dead object.
+	 */
+	TSharedPtr<FDialogueTextPrefetchCache, ESPMode::ThreadSafe> Cache;
+
+};
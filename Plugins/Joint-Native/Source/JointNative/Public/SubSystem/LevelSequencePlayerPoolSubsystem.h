@@ -0,0 +1,124 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovieSceneSequencePlaybackSettings.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LevelSequencePlayerPoolSubsystem.generated.h"
+
+class ALevelSequenceActor;
+class ULevelSequence;
+
+/**
+ * A listener that the level sequence player pool binds to the player of each acquired actor.
+ * The dynamic delegates of the player don't tell which player has fired them, so each actor gets its own listener to know which one to release.
+ *
+ * Joint Native 1.16: Introduced.
+ */
+UCLASS(Transient)
+class JOINTNATIVE_API ULevelSequencePlayerPoolListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	void BindToActor(ALevelSequenceActor* InActor);
+
+	void UnbindFromActor();
+
+private:
+
+	UFUNCTION()
+	void OnPlayerFinished();
+
+	UFUNCTION()
+	void OnPlayerStopped();
+
+private:
+
+	UPROPERTY(Transient)
+	TObjectPtr<ALevelSequenceActor> Actor = nullptr;
+
+};
+
+/**
+ * A world subsystem that keeps a pool of the level sequence actors (and their players) to reuse them across the sequence playbacks.
+ *
+ * Spawning a level sequence actor for every playback is expensive, and the spawned actors used to stay in the world forever.
+ * With the pool, an idle actor gets rebound to the new sequence & playback settings instead, and the actors return to the pool automatically when their playback finishes or gets stopped.
+ * The actors that exceed the pool size (UJointNativeSettings::LevelSequencePoolMaxSize) on the return will be destroyed.
+ *
+ * Actors that play with bPauseAtEnd never finish by themselves. Stop them or call ReleaseLevelSequenceActor() to return them.
+ *
+ * Joint Native 1.16: Introduced for UDF_LevelSequence.
+ */
+UCLASS()
+class JOINTNATIVE_API ULevelSequencePlayerPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Get the level sequence player pool of the world the provided object is in.
+	 * @param WorldContextObject An object that this function will grab the world from.
+	 * @return The subsystem for the world. nullptr if the world is not available.
+	 */
+	static ULevelSequencePlayerPoolSubsystem* Get(const UObject* WorldContextObject);
+
+public:
+
+	/**
+	 * Get a level sequence actor that is bound to the provided sequence and playback settings, from the pool if possible.
+	 * If the settings have bAutoPlay, the sequence will start playing right away.
+	 * The actor will return to the pool by itself when the playback finishes or gets stopped. Call ReleaseLevelSequenceActor() to return it earlier, or to return an actor that has paused at the end.
+	 * @param Sequence The sequence to play.
+	 * @param Settings The playback settings to use.
+	 * @return The level sequence actor. nullptr if the sequence is not valid.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Level Sequence Pool")
+	ALevelSequenceActor* AcquireLevelSequenceActor(ULevelSequence* Sequence, const FMovieSceneSequencePlaybackSettings& Settings);
+
+	/**
+	 * Stop the actor and return it to the pool. It will be destroyed instead if the pool is already full.
+	 * @param Actor The actor that has been acquired from this pool.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Level Sequence Pool")
+	void ReleaseLevelSequenceActor(ALevelSequenceActor* Actor);
+
+	/**
+	 * Destroy all the idle actors in the pool.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Level Sequence Pool")
+	void EmptyPool();
+
+public:
+
+	virtual void Deinitialize() override;
+
+private:
+
+	friend class ULevelSequencePlayerPoolListener;
+
+	/**
+	 * Queue the actor to be released on the next tick. The player is still in the middle of its update when it fires its delegates.
+	 */
+	void ScheduleRelease(ALevelSequenceActor* Actor);
+
+	void ReleaseScheduledActors();
+
+private:
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ALevelSequenceActor>> IdleActors;
+
+	/**
+	 * The acquired actors and the listeners bound to their players.
+	 */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<ALevelSequenceActor>, TObjectPtr<ULevelSequencePlayerPoolListener>> ActiveActors;
+
+	TArray<TWeakObjectPtr<ALevelSequenceActor>> ScheduledReleases;
+
+};
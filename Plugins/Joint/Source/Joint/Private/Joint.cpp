@@ -2,6 +2,9 @@
 
 #include "Joint.h"
 
+#include "JointFunctionLibrary.h"
+#include "SharedType/JointBuildPreset.h"
+
 #define LOCTEXT_NAMESPACE "FJointModule"
 
 void FJointModule::StartupModule()
@@ -13,6 +16,13 @@ void FJointModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	// Release the cached merged text style tables while the object system is still alive.
+	UJointFunctionLibrary::ClearMergedTextStyleTableCache();
+
+#if WITH_EDITOR
+	FJointBuildPresetCache::Get().Reset();
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
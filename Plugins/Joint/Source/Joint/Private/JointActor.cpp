@@ -9,10 +9,21 @@
 #include "Joint.h"
 #include "JointLogChannels.h"
 #include "Subsystem/JointSubsystem.h"
+#include "SharedType/JointExecutionTrace.h"
 
 #include "Engine/ActorChannel.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UnrealType.h"
 
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
@@ -68,6 +79,56 @@
 	} while (0)
 
 
+static TAutoConsoleVariable<int32> CVarJointTraceEnable(
+	TEXT("Joint.Trace.Enable"),
+	0,
+	TEXT("Whether the Joint actors start recording their execution traces on the start. (0 : Off, 1 : On)"));
+
+static TAutoConsoleVariable<int32> CVarJointTraceCapacity(
+	TEXT("Joint.Trace.Capacity"),
+	4096,
+	TEXT("The number of the records each Joint actor keeps on its execution trace."));
+
+static FAutoConsoleCommandWithWorld JointTraceDumpCommand(
+	TEXT("Joint.Trace.Dump"),
+	TEXT("Write the execution traces of all the Joint actors in the world to Saved/Joint/Traces."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (World == nullptr) return;
+
+		for (TActorIterator<AJointActor> It(World); It; ++It)
+		{
+			const FString FilePath = It->DumpExecutionTrace();
+
+			if (!FilePath.IsEmpty()) UE_LOG(LogJoint, Log, TEXT("Joint: Execution trace of %s has been written to %s."), *It->GetName(), *FilePath);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs JointTraceReplayCommand(
+	TEXT("Joint.Trace.Replay"),
+	TEXT("Create a Joint actor for the Joint manager of the provided execution trace file and replay the trace on it. Usage: Joint.Trace.Replay <FilePath>"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (World == nullptr || Args.IsEmpty()) return;
+
+		FJointExecutionTrace Trace;
+
+		if (!FJointExecutionTrace::LoadFromFile(Args[0], Trace))
+		{
+			UE_LOG(LogJoint, Error, TEXT("Joint: Failed to load the execution trace from %s."), *Args[0]);
+
+			return;
+		}
+
+		UJointManager* TracedJointManager = Cast<UJointManager>(Trace.JointManagerPath.TryLoad());
+
+		if (AJointActor* JointActor = UJointSubsystem::CreateJoint(World, TracedJointManager, nullptr))
+		{
+			JointActor->ReplayExecutionTrace(Trace);
+		}
+	}));
+
+
 // Sets default values
 AJointActor::AJointActor()
 {
@@ -150,6 +211,10 @@ void AJointActor::PopExecutionQueue()
 		return;
 	}
 #endif
+
+	if (ExecutionTrace) ExecutionTrace->RecordExecution(Item.ExecutionType, Item.TargetNode.Get());
+
+	if (ExecutionTraceReplay) ExecutionTraceReplay->NotifyExecuted(Item.ExecutionType, Item.TargetNode.IsValid() ? Item.TargetNode->NodeGuid : FGuid());
 	
 #if DEBUG_ShowJointEvent_PopExecutionQueue
 	
@@ -226,15 +291,556 @@ void AJointActor::ClearExecutionQueue()
 void AJointActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	EndJoint();
+
+	ReleaseAllAssetPrefetches();
 	
 	Super::EndPlay(EndPlayReason);
 }
 
+void AJointActor::UpdateAssetPrefetch()
+{
+	//The graph might have been changed - walk it again from scratch.
+	AssetPrefetchNextNodeCache.Empty();
+	AssetPrefetchRootNode.Reset();
+	AssetPrefetchRootDepth = INDEX_NONE;
+
+	RefreshAssetPrefetch();
+}
+
+const TArray<TWeakObjectPtr<UJointNodeBase>>& AJointActor::GetCachedPossibleNextNodes(UJointNodeBase* Node)
+{
+	if (const TArray<TWeakObjectPtr<UJointNodeBase>>* Found = AssetPrefetchNextNodeCache.Find(Node)) return *Found;
+
+	TArray<UJointNodeBase*> PossibleNextNodes;
+
+	Node->GetPossibleNextNodes(PossibleNextNodes);
+
+	TArray<TWeakObjectPtr<UJointNodeBase>>& CachedNextNodes = AssetPrefetchNextNodeCache.Add(Node);
+
+	CachedNextNodes.Reserve(PossibleNextNodes.Num());
+
+	for (UJointNodeBase* PossibleNextNode : PossibleNextNodes)
+	{
+		if (PossibleNextNode) CachedNextNodes.Add(PossibleNextNode);
+	}
+
+	return CachedNextNodes;
+}
+
+void AJointActor::RefreshAssetPrefetch()
+{
+	if (!bPrefetchAssets || PlayingJointNode == nullptr || !UAssetManager::IsInitialized())
+	{
+		ReleaseAllAssetPrefetches();
+
+		return;
+	}
+
+	//Nothing to do if we are still on the same node - the handles are already there.
+	if (AssetPrefetchRootNode == PlayingJointNode && AssetPrefetchRootDepth == AssetPrefetchDepth) return;
+
+	AssetPrefetchRootNode = PlayingJointNode;
+	AssetPrefetchRootDepth = AssetPrefetchDepth;
+
+	//Walk the graph from the playing node, step by step. The nodes are collected in the order of their distance.
+	TArray<TPair<UJointNodeBase*, int32>> ReachableNodes;
+	TSet<UJointNodeBase*> VisitedNodes;
+
+	ReachableNodes.Emplace(PlayingJointNode, 0);
+	VisitedNodes.Add(PlayingJointNode);
+
+	for (int32 Index = 0; Index < ReachableNodes.Num(); ++Index)
+	{
+		const int32 Distance = ReachableNodes[Index].Value;
+
+		if (Distance >= AssetPrefetchDepth) continue;
+
+		for (const TWeakObjectPtr<UJointNodeBase>& WeakNextNode : GetCachedPossibleNextNodes(ReachableNodes[Index].Key))
+		{
+			UJointNodeBase* PossibleNextNode = WeakNextNode.Get();
+
+			if (PossibleNextNode == nullptr || VisitedNodes.Contains(PossibleNextNode)) continue;
+
+			VisitedNodes.Add(PossibleNextNode);
+			ReachableNodes.Emplace(PossibleNextNode, Distance + 1);
+		}
+	}
+
+	//Release the branches that can not be reached anymore.
+	for (auto It = AssetPrefetchHandles.CreateIterator(); It; ++It)
+	{
+		UJointNodeBase* Node = It.Key().Get();
+
+		if (Node != nullptr && VisitedNodes.Contains(Node)) continue;
+
+		if (It.Value().IsValid()) It.Value()->ReleaseHandle();
+
+		It.RemoveCurrent();
+	}
+
+	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+
+	TArray<FSoftObjectPath> AssetPaths;
+
+	for (const TPair<UJointNodeBase*, int32>& ReachableNode : ReachableNodes)
+	{
+		UJointNodeBase* Node = ReachableNode.Key;
+
+		if (AssetPrefetchHandles.Contains(Node)) continue;
+
+		AssetPaths.Reset();
+
+		Node->CollectAssetsToPrefetch(AssetPaths);
+
+		for (UJointFragment* Fragment : Node->GetAllFragmentsOnLowerHierarchy())
+		{
+			if (Fragment) Fragment->CollectAssetsToPrefetch(AssetPaths);
+		}
+
+		TSharedPtr<FStreamableHandle> Handle;
+
+		if (!AssetPaths.IsEmpty())
+		{
+			//Load all the assets of a node in one request, and let the nearer nodes go first.
+			const TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority + (AssetPrefetchDepth - ReachableNode.Value);
+
+			Handle = StreamableManager.RequestAsyncLoad(AssetPaths, FStreamableDelegate(), Priority, true, false, TEXT("JointAssetPrefetch"));
+		}
+
+		AssetPrefetchHandles.Add(Node, Handle);
+	}
+}
+
+void AJointActor::ReleaseAllAssetPrefetches()
+{
+	for (TPair<TWeakObjectPtr<UJointNodeBase>, TSharedPtr<FStreamableHandle>>& AssetPrefetchHandle : AssetPrefetchHandles)
+	{
+		if (AssetPrefetchHandle.Value.IsValid()) AssetPrefetchHandle.Value->ReleaseHandle();
+	}
+
+	AssetPrefetchHandles.Empty();
+
+	AssetPrefetchNextNodeCache.Empty();
+	AssetPrefetchRootNode.Reset();
+	AssetPrefetchRootDepth = INDEX_NONE;
+}
+
+namespace JointProgressSnapshot
+{
+	static constexpr uint32 Magic = 0x4A50534E; // 'JPSN'
+	
+	static constexpr uint8 Version = 1;
+
+	enum EJointFlags : uint8
+	{
+		JointFlag_Started = 1 << 0,
+		JointFlag_Ended = 1 << 1,
+	};
+
+	enum ENodeFlags : uint8
+	{
+		NodeFlag_BegunPlay = 1 << 0,
+		NodeFlag_EndedPlay = 1 << 1,
+		NodeFlag_Pending = 1 << 2,
+		NodeFlag_HasProperties = 1 << 3,
+	};
+
+	bool HasSaveGameProperties(const UClass* InClass)
+	{
+		check(IsInGameThread());
+
+		//The properties of a class don't change. A recompiled blueprint class is a new class object with a new key.
+		static TMap<FObjectKey, bool> CachedResults;
+
+		if (const bool* Found = CachedResults.Find(InClass)) return *Found;
+
+		bool bHasSaveGameProperties = false;
+
+		for (TFieldIterator<FProperty> It(InClass); It; ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_SaveGame))
+			{
+				bHasSaveGameProperties = true;
+
+				break;
+			}
+		}
+
+		CachedResults.Add(InClass, bHasSaveGameProperties);
+
+		return bHasSaveGameProperties;
+	}
+
+	void SerializeSaveGameProperties(FArchive& Ar, UJointNodeBase* Node)
+	{
+		FObjectAndNameAsStringProxyArchive ProxyAr(Ar, true);
+		ProxyAr.ArIsSaveGame = true;
+
+		Node->GetClass()->SerializeTaggedProperties(ProxyAr, reinterpret_cast<uint8*>(Node), Node->GetClass(), nullptr);
+	}
+
+	void CollectNodes(UJointManager* InJointManager, TArray<UJointNodeBase*>& OutNodes)
+	{
+		if (InJointManager->HasBakedGraph())
+		{
+			const FJointBakedGraph& BakedGraph = InJointManager->GetBakedGraph();
+
+			OutNodes.Reserve(BakedGraph.Num());
+
+			for (int32 NodeIndex = 0; NodeIndex < BakedGraph.Num(); ++NodeIndex)
+			{
+				if (UJointNodeBase* Node = BakedGraph.GetNodeObject(NodeIndex)) OutNodes.Add(Node);
+			}
+
+			return;
+		}
+
+		auto AddWithFragments = [&OutNodes](UJointNodeBase* Node)
+		{
+			if (Node == nullptr) return;
+
+			OutNodes.Add(Node);
+
+			for (UJointFragment* Fragment : Node->GetAllFragmentsOnLowerHierarchy())
+			{
+				if (Fragment) OutNodes.Add(Fragment);
+			}
+		};
+
+		for (UJointNodeBase* ManagerFragment : InJointManager->ManagerFragments) AddWithFragments(ManagerFragment);
+
+		for (UJointNodeBase* Node : InJointManager->Nodes) AddWithFragments(Node);
+	}
+}
+
+bool AJointActor::CaptureProgressSnapshot(FJointProgressSnapshot& OutSnapshot)
+{
+	if (JointManager == nullptr) return false;
+
+	OutSnapshot.JointGuid = JointGuid;
+	OutSnapshot.JointManager = SourceJointManager;
+	
+	//Keep the slack of the previous capture.
+	OutSnapshot.Data.Reset();
+
+	FMemoryWriter Writer(OutSnapshot.Data);
+
+	uint32 Magic = JointProgressSnapshot::Magic;
+	uint8 Version = JointProgressSnapshot::Version;
+	uint8 JointFlags = (bIsJointStarted ? JointProgressSnapshot::JointFlag_Started : 0) | (bIsJointEnded ? JointProgressSnapshot::JointFlag_Ended : 0);
+	FGuid PlayingNodeGuid = PlayingJointNode ? PlayingJointNode->NodeGuid : FGuid();
+
+	Writer << Magic << Version << JointFlags << PlayingNodeGuid;
+
+	//Written after the entries.
+	int32 NumEntries = 0;
+	const int64 NumEntriesOffset = Writer.Tell();
+	Writer << NumEntries;
+
+	TArray<UJointNodeBase*> AllNodes;
+	JointProgressSnapshot::CollectNodes(JointManager, AllNodes);
+
+	for (UJointNodeBase* Node : AllNodes)
+	{
+		uint8 NodeFlags = (Node->bIsNodeBegunPlay ? JointProgressSnapshot::NodeFlag_BegunPlay : 0)
+			| (Node->bIsNodeEndedPlay ? JointProgressSnapshot::NodeFlag_EndedPlay : 0)
+			| (Node->bIsNodePending ? JointProgressSnapshot::NodeFlag_Pending : 0);
+
+		if (JointProgressSnapshot::HasSaveGameProperties(Node->GetClass())) NodeFlags |= JointProgressSnapshot::NodeFlag_HasProperties;
+
+		//Nodes that have never been touched and have nothing to save can be left as they are on the restore.
+		if (NodeFlags == 0) continue;
+
+		Writer << Node->NodeGuid << NodeFlags;
+
+		if (NodeFlags & JointProgressSnapshot::NodeFlag_HasProperties)
+		{
+			int32 PropertiesSize = 0;
+			const int64 PropertiesSizeOffset = Writer.Tell();
+			Writer << PropertiesSize;
+
+			JointProgressSnapshot::SerializeSaveGameProperties(Writer, Node);
+
+			const int64 PropertiesEndOffset = Writer.Tell();
+			PropertiesSize = static_cast<int32>(PropertiesEndOffset - PropertiesSizeOffset - sizeof(int32));
+
+			Writer.Seek(PropertiesSizeOffset);
+			Writer << PropertiesSize;
+			Writer.Seek(PropertiesEndOffset);
+		}
+
+		++NumEntries;
+	}
+
+	const int64 EndOffset = Writer.Tell();
+	Writer.Seek(NumEntriesOffset);
+	Writer << NumEntries;
+	Writer.Seek(EndOffset);
+
+	return true;
+}
+
+bool AJointActor::RestoreProgressSnapshot(const FJointProgressSnapshot& Snapshot)
+{
+	if (JointManager == nullptr || IsJointStarted() || !Snapshot.IsValid()) return false;
+
+	FMemoryReader Reader(Snapshot.Data);
+
+	uint32 Magic = 0;
+	uint8 Version = 0;
+	uint8 JointFlags = 0;
+	FGuid PlayingNodeGuid;
+	int32 NumEntries = 0;
+
+	Reader << Magic << Version;
+
+	if (Magic != JointProgressSnapshot::Magic || Version != JointProgressSnapshot::Version)
+	{
+		UE_LOG(LogJoint, Error, TEXT("Joint: Tried to restore a progress snapshot that is not compatible with this version (snapshot version: %d, current version: %d) on %s. Aborting the action..."), Version, JointProgressSnapshot::Version, *GetName());
+
+		return false;
+	}
+
+	Reader << JointFlags << PlayingNodeGuid << NumEntries;
+
+	//Look up the nodes with the baked graph if possible, otherwise index them once here.
+	const bool bUseBakedGraph = JointManager->HasBakedGraph();
+
+	TMap<FGuid, UJointNodeBase*> NodeMap;
+
+	if (!bUseBakedGraph)
+	{
+		TArray<UJointNodeBase*> AllNodes;
+		JointProgressSnapshot::CollectNodes(JointManager, AllNodes);
+
+		NodeMap.Reserve(AllNodes.Num());
+
+		for (UJointNodeBase* Node : AllNodes) NodeMap.Add(Node->NodeGuid, Node);
+	}
+
+	auto FindNode = [this, bUseBakedGraph, &NodeMap](const FGuid& NodeGuid) -> UJointNodeBase*
+	{
+		if (bUseBakedGraph)
+		{
+			const FJointBakedGraph& BakedGraph = JointManager->GetBakedGraph();
+
+			return BakedGraph.GetNodeObject(BakedGraph.FindNodeIndex(NodeGuid));
+		}
+
+		UJointNodeBase* const* FoundNode = NodeMap.Find(NodeGuid);
+
+		return FoundNode ? *FoundNode : nullptr;
+	};
+
+	TArray<UJointNodeBase*> RestoredNodes;
+	RestoredNodes.Reserve(NumEntries);
+
+	int32 NumMissingNodes = 0;
+
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries && !Reader.IsError(); ++EntryIndex)
+	{
+		FGuid NodeGuid;
+		uint8 NodeFlags = 0;
+
+		Reader << NodeGuid << NodeFlags;
+
+		UJointNodeBase* Node = FindNode(NodeGuid);
+
+		if (NodeFlags & JointProgressSnapshot::NodeFlag_HasProperties)
+		{
+			int32 PropertiesSize = 0;
+			Reader << PropertiesSize;
+
+			const int64 PropertiesEndOffset = Reader.Tell() + PropertiesSize;
+
+			if (Node) JointProgressSnapshot::SerializeSaveGameProperties(Reader, Node);
+
+			//Skip whatever has not been read, in case of the missing nodes or the changed classes.
+			Reader.Seek(PropertiesEndOffset);
+		}
+
+		if (Node == nullptr)
+		{
+			++NumMissingNodes;
+
+			continue;
+		}
+
+		Node->bIsNodeBegunPlay = (NodeFlags & JointProgressSnapshot::NodeFlag_BegunPlay) != 0;
+		Node->bIsNodeEndedPlay = (NodeFlags & JointProgressSnapshot::NodeFlag_EndedPlay) != 0;
+		Node->bIsNodePending = (NodeFlags & JointProgressSnapshot::NodeFlag_Pending) != 0;
+
+		if (Node->bIsNodeBegunPlay) Node->SetHostingJointInstance(this);
+
+		if (Node->IsNodeActive()) KnownActiveNodes.AddUnique(Node);
+
+		RestoredNodes.Add(Node);
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogJoint, Error, TEXT("Joint: The progress snapshot restored on %s is corrupted. The node states might be partially restored."), *GetName());
+	}
+
+	if (NumMissingNodes > 0)
+	{
+		UE_LOG(LogJoint, Warning, TEXT("Joint: %d node(s) on the progress snapshot could not be found on %s and have been skipped. The Joint manager might have been changed after the capture."), NumMissingNodes, *GetName());
+	}
+
+	if (Snapshot.JointGuid.IsValid()) JointGuid = Snapshot.JointGuid;
+
+	bIsJointStarted = (JointFlags & JointProgressSnapshot::JointFlag_Started) != 0;
+	bIsJointEnded = (JointFlags & JointProgressSnapshot::JointFlag_Ended) != 0;
+
+	PlayingJointNode = PlayingNodeGuid.IsValid() ? FindNode(PlayingNodeGuid) : nullptr;
+
+	CacheNodesForNetworking();
+
+	if (PlayingJointNode && bIsJointStarted && !bIsJointEnded)
+	{
+		//Bind locally - the restoration happens on each side by itself.
+		BindEventsOnPlayingJointNode_Implementation();
+	}
+
+	for (UJointNodeBase* RestoredNode : RestoredNodes)
+	{
+		RestoredNode->PostNodeProgressRestored();
+	}
+
+	UpdateAssetPrefetch();
+
+	return true;
+}
+
+void AJointActor::StartExecutionTrace(const int32 Capacity)
+{
+	ExecutionTrace = MakeShared<FJointExecutionTrace>(Capacity);
+	ExecutionTrace->JointGuid = JointGuid;
+	ExecutionTrace->JointManagerPath = SourceJointManager.ToSoftObjectPath();
+}
+
+void AJointActor::StopExecutionTrace()
+{
+	ExecutionTrace.Reset();
+}
+
+bool AJointActor::IsRecordingExecutionTrace() const
+{
+	return ExecutionTrace.IsValid();
+}
+
+FString AJointActor::DumpExecutionTrace(const FString& FilePath)
+{
+	if (!ExecutionTrace || ExecutionTrace->Num() == 0) return FString();
+
+	const FString TargetFilePath = FilePath.IsEmpty() ? FJointExecutionTrace::MakeDumpFilePath(this) : FilePath;
+
+	return ExecutionTrace->SaveToFile(TargetFilePath) ? TargetFilePath : FString();
+}
+
+const FJointExecutionTrace* AJointActor::GetExecutionTrace() const
+{
+	return ExecutionTrace.Get();
+}
+
+bool AJointActor::SelectNextNodesFromReplay(FJointNodeSelection& OutNodes)
+{
+	if (!ExecutionTraceReplay || JointManager == nullptr || PlayingJointNode == nullptr) return false;
+
+	TArray<FGuid, TInlineAllocator<4>> SelectedNodeGuids;
+
+	if (!ExecutionTraceReplay->ConsumeSelection(PlayingJointNode->NodeGuid, SelectedNodeGuids)) return false;
+
+	for (const FGuid& SelectedNodeGuid : SelectedNodeGuids)
+	{
+		UJointNodeBase* SelectedNode = JointManager->FindBaseNodeWithGuid(SelectedNodeGuid);
+
+		OutNodes.Add(SelectedNode ? SelectedNode : JointManager->FindFragmentWithGuid(SelectedNodeGuid));
+	}
+
+	return true;
+}
+
+bool AJointActor::ReplayExecutionTrace(const FJointExecutionTrace& Trace, const int32 MaxSteps)
+{
+	if (JointManager == nullptr || IsJointStarted()) return false;
+
+	if (Trace.HasWrapped())
+	{
+		UE_LOG(LogJoint, Error, TEXT("Joint: The execution trace for %s does not contain the start of the Joint (the ring buffer has wrapped). Record it again with a larger Joint.Trace.Capacity."), *GetName());
+
+		return false;
+	}
+
+	ExecutionTraceReplay = MakeShared<FJointExecutionTraceReplay>(Trace);
+
+	const double ReplayStartSeconds = FPlatformTime::Seconds();
+
+	StartJoint();
+
+	//The Joint runs synchronously as far as it can on each request. Issue the next recorded request whenever it stops by itself.
+	int32 NumSteps = 0;
+
+	while (!ExecutionTraceReplay->IsFinished() && !IsJointEnded() && NumSteps < MaxSteps)
+	{
+		++NumSteps;
+
+		const FJointTraceRecord NextExecution = *ExecutionTraceReplay->PeekExecution();
+		const int32 NumReplayedExecutions = ExecutionTraceReplay->GetNumReplayedExecutions();
+
+		UJointNodeBase* Node = JointManager->FindBaseNodeWithGuid(NextExecution.NodeGuid);
+
+		if (Node == nullptr) Node = JointManager->FindFragmentWithGuid(NextExecution.NodeGuid);
+
+		switch (NextExecution.ExecutionType)
+		{
+		case EJointActorExecutionType::PreBeginPlay:
+			RequestNodeBeginPlay(Node);
+			break;
+		case EJointActorExecutionType::PrePending:
+			RequestMarkNodeAsPending(Node);
+			break;
+		case EJointActorExecutionType::PreEndPlay:
+			RequestNodeEndPlay(Node);
+			break;
+		default:
+			break;
+		}
+
+		//Nothing has happened for the record - the Joint has gone on a different path here.
+		if (NumReplayedExecutions == ExecutionTraceReplay->GetNumReplayedExecutions()) ExecutionTraceReplay->SkipExecution();
+	}
+
+	const bool bSucceeded = ExecutionTraceReplay->IsFinished() && ExecutionTraceReplay->GetNumDivergences() == 0;
+
+	UE_LOG(LogJoint, Log, TEXT("Joint: Replayed the execution trace on %s in %.3f ms. Replayed executions: %d, Divergences: %d, Finished: %s"),
+		*GetName(),
+		(FPlatformTime::Seconds() - ReplayStartSeconds) * 1000.0,
+		ExecutionTraceReplay->GetNumReplayedExecutions(),
+		ExecutionTraceReplay->GetNumDivergences(),
+		ExecutionTraceReplay->IsFinished() ? TEXT("true") : TEXT("false"));
+
+	ExecutionTraceReplay.Reset();
+
+	return bSucceeded;
+}
+
 UJointNodeBase* AJointActor::GetPlayingJointNode()
 {
 	return PlayingJointNode;
 }
 
+bool AJointActor::CanStillReachNode(FGuid NodeGuid)
+{
+	const UJointManager* Manager = GetJointManager();
+
+	const UJointNodeBase* PlayingBaseNode = PlayingJointNode ? PlayingJointNode->GetParentmostNode() : nullptr;
+
+	if (Manager == nullptr || PlayingBaseNode == nullptr) return false;
+
+	return Manager->CanReachNode(PlayingBaseNode->GetNodeGuid(), NodeGuid);
+}
+
 void AJointActor::OnRep_CachedNodesForNetworking(
 	const TArray<UJointNodeBase*>& PreviousCachedNodesForNetworking)
 {
@@ -298,9 +904,13 @@ void AJointActor::RequestSetJointManager_Implementation(UJointManager* NewJointM
 		//For debugging purpose.
 
 		OriginalJointManager = NewJointManager;
+
+		if (DuplicatedJointManager) DuplicatedJointManager->BakeGraphForPlayInEditor();
 #endif
 
 		JointManager = DuplicatedJointManager;
+
+		SourceJointManager = NewJointManager;
 		
 		//SetJointManager(DuplicatedJointManager);
 		
@@ -352,9 +962,9 @@ void AJointActor::ReleaseEventsFromPlayingJointNode_Implementation()
 	//Remove old delegate
 	if (PlayingJointNode == nullptr) return;
 
-	PlayingJointNode->OnJointNodeMarkedAsPendingDelegate.RemoveAll(this);
+	PlayingJointNode->OnJointNodeMarkedAsPendingNative.RemoveAll(this);
 
-	PlayingJointNode->OnJointNodeEndDelegate.RemoveAll(this);
+	PlayingJointNode->OnJointNodeEndNative.RemoveAll(this);
 }
 
 void AJointActor::BindEventsOnPlayingJointNode_Implementation()
@@ -362,15 +972,15 @@ void AJointActor::BindEventsOnPlayingJointNode_Implementation()
 	if (PlayingJointNode == nullptr) return;
 
 	//Bind delegate
-	PlayingJointNode->OnJointNodeMarkedAsPendingDelegate.RemoveAll(this);
+	PlayingJointNode->OnJointNodeMarkedAsPendingNative.RemoveAll(this);
 
-	PlayingJointNode->OnJointNodeEndDelegate.RemoveAll(this);
+	PlayingJointNode->OnJointNodeEndNative.RemoveAll(this);
 
 
-	PlayingJointNode->OnJointNodeMarkedAsPendingDelegate.AddDynamic(
+	PlayingJointNode->OnJointNodeMarkedAsPendingNative.AddUObject(
 		this, &AJointActor::OnNotifiedCurrentNodePending);
 
-	PlayingJointNode->OnJointNodeEndDelegate.AddDynamic(
+	PlayingJointNode->OnJointNodeEndNative.AddUObject(
 		this, &AJointActor::OnNotifiedCurrentNodeEnded);
 }
 
@@ -398,6 +1008,8 @@ void AJointActor::BeginPlayPlayingJointNode_Implementation()
 			OnJointBaseNodePlayedDelegate.Broadcast(this, PlayingJointNode);
 		}
 		RequestNodeBeginPlay(PlayingJointNode);
+
+		RefreshAssetPrefetch();
 	}
 }
 
@@ -421,6 +1033,18 @@ UJointNodeBase* AJointActor::PickUpNewNodeFrom(const TArray<UJointNodeBase*>& Te
 	return nullptr;
 }
 
+UJointNodeBase* AJointActor::PickUpNewNodeFrom(const FJointNodeSelection& TestTargetNodes)
+{
+	for (UJointNodeBase* TargetNode : TestTargetNodes)
+	{
+		if (!TargetNode) continue;
+
+		return TargetNode;
+	}
+
+	return nullptr;
+}
+
 bool AJointActor::IsJointStarted()
 {
 	return bIsJointStarted;
@@ -453,6 +1077,8 @@ void AJointActor::StartJoint_Implementation()
 #endif
 	
 	CacheNodesForNetworking();
+
+	if (!ExecutionTrace && CVarJointTraceEnable.GetValueOnGameThread() != 0) StartExecutionTrace(CVarJointTraceCapacity.GetValueOnGameThread());
 	
 	//Multicast the actual action on the Joint start event.
 	ProcessStartJoint();
@@ -577,6 +1203,8 @@ void AJointActor::ProcessEndJoint_Implementation()
 
 	MarkAsEnded();
 
+	ReleaseAllAssetPrefetches();
+
 	NotifyEndJoint();
 
 	if (OnJointEndedDelegate.IsBound())
@@ -621,7 +1249,19 @@ void AJointActor::PlayNextNode_Implementation()
 	EndPlayPlayingJointNode();
 	
 	//Select new node from the last node.
-	if (PlayingJointNode) SetPlayingJointNode(PickUpNewNodeFrom(PlayingJointNode->SelectNextNodes(this)));
+	if (PlayingJointNode)
+	{
+		FJointNodeSelection NextNodes;
+
+		const bool bSelectionOverridden = SelectNextNodesFromReplay(NextNodes)
+			|| (NextNodeSelectionOverride.IsBound() && NextNodeSelectionOverride.Execute(PlayingJointNode, NextNodes));
+
+		if (!bSelectionOverridden) PlayingJointNode->SelectNextNodesInto(this, NextNodes);
+
+		if (ExecutionTrace) ExecutionTrace->RecordSelection(PlayingJointNode, NextNodes);
+
+		SetPlayingJointNode(PickUpNewNodeFrom(NextNodes));
+	}
 	
 	// Clear the execution queue to avoid any pending actions on the previous node.
 	//ClearExecutionQueue();
@@ -868,17 +1508,29 @@ void AJointActor::ProcessPostMarkNodeAsPending(UJointNodeBase* InNode)
 
 void AJointActor::NotifyNodeBeginPlay(UJointNodeBase* InNode)
 {
-	if (IsValidLowLevel() && OnJointNodeBeginPlayDelegate.IsBound()) OnJointNodeBeginPlayDelegate.Broadcast(this, InNode);
+	if (!IsValidLowLevel()) return;
+
+	OnJointNodeBeginPlayNative.Broadcast(this, InNode);
+
+	if (OnJointNodeBeginPlayDelegate.IsBound()) OnJointNodeBeginPlayDelegate.Broadcast(this, InNode);
 }
 
 void AJointActor::NotifyNodeEndPlay(UJointNodeBase* InNode)
 {
-	if (IsValidLowLevel() && OnJointNodeEndPlayDelegate.IsBound()) OnJointNodeEndPlayDelegate.Broadcast(this, InNode);
+	if (!IsValidLowLevel()) return;
+
+	OnJointNodeEndPlayNative.Broadcast(this, InNode);
+
+	if (OnJointNodeEndPlayDelegate.IsBound()) OnJointNodeEndPlayDelegate.Broadcast(this, InNode);
 }
 
 void AJointActor::NotifyNodeMarkedAsPending(UJointNodeBase* InNode)
 {
-	if (IsValidLowLevel() && OnJointNodeMarkedAsPendingDelegate.IsBound()) OnJointNodeMarkedAsPendingDelegate.Broadcast(this, InNode);
+	if (!IsValidLowLevel()) return;
+
+	OnJointNodeMarkedAsPendingNative.Broadcast(this, InNode);
+
+	if (OnJointNodeMarkedAsPendingDelegate.IsBound()) OnJointNodeMarkedAsPendingDelegate.Broadcast(this, InNode);
 }
 
 
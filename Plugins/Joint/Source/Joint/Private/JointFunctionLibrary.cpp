@@ -9,8 +9,14 @@
 #include "SharedType/JointSharedTypes.h"
 #include "Components/RichTextBlock.h"
 #include "Components/Widget.h"
+#include "Containers/LruCache.h"
 #include "Engine/DataTable.h"
 #include "Framework/Text/RichTextMarkupProcessing.h"
+#include "Internationalization/Culture.h"
+#include "Internationalization/Internationalization.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectGlobals.h"
 #include "Node/JointNodeBase.h"
 #include "Sequencer/MovieSceneJointTrack.h"
 
@@ -40,78 +46,142 @@ FText UJointFunctionLibrary::FormatTextWith(FText InText, FString Target, FText
 	return FText::Format(InText, FormatArgs);
 }
 
-TArray<FInt32Range> UJointFunctionLibrary::GetTextContentRange(const FText InText)
+namespace JointRichTextParseCache
 {
-	TArray<FInt32Range> OutRange;
+	//Default number of the cached parse results.
+	constexpr int32 DefaultCapacity = 256;
 
-	const TSharedRef<FDefaultRichTextMarkupParser> Parser = FDefaultRichTextMarkupParser::Create();
+	struct FKey
+	{
+	public:
 
-	TArray<FTextLineParseResults> Results;
+		FKey(const FString& InSourceString, const FString& InCultureName) :
+			SourceString(InSourceString),
+			CultureName(InCultureName),
+			Hash(HashCombine(GetTypeHash(InSourceString), GetTypeHash(InCultureName)))
+		{
+		}
 
-	FString OutputString;
+		bool operator==(const FKey& Other) const
+		{
+			return Hash == Other.Hash && SourceString.Equals(Other.SourceString, ESearchCase::CaseSensitive) && CultureName == Other.CultureName;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return Key.Hash;
+		}
 
-	Parser->Process(Results, InText.ToString(), OutputString);
+	public:
 
-	int LineIndex = 0;
+		FString SourceString;
+		FString CultureName;
+		uint32 Hash;
+	};
 
-	for (FTextLineParseResults& Result : Results)
+	using FResultRef = TSharedRef<const FJointRichTextParseResult, ESPMode::ThreadSafe>;
+
+	struct FCache
 	{
-		for (FTextRunParseResults& Run : Result.Runs)
-		{
-			if (Run.ContentRange.Len() != 0)
-			{
-				FInt32Range Range = FInt32Range(Run.ContentRange.BeginIndex + LineIndex * 2,
-				                                Run.ContentRange.EndIndex + 1 + LineIndex * 2);
+	public:
 
-				OutRange.Add(Range);
-			}else if(Run.Name == "" && Run.OriginalRange.Len() != 0) // if this is an empty run...
-			{
-				FInt32Range Range = FInt32Range(Run.OriginalRange.BeginIndex + LineIndex * 2,
-											Run.OriginalRange.EndIndex + 1 + LineIndex * 2);
+		FCache() : Results(DefaultCapacity) {}
 
-				OutRange.Add(Range);
-			}
-		}
+	public:
 
-		LineIndex++;
+		FCriticalSection Mutex;
+
+		TLruCache<FKey, FResultRef> Results;
+
+		int64 Hits = 0;
+		int64 Misses = 0;
+	};
+
+	FCache& Get()
+	{
+		static FCache Cache;
+
+		return Cache;
 	}
+}
 
-	return OutRange;
+TArray<FInt32Range> UJointFunctionLibrary::GetTextContentRange(const FText InText)
+{
+	return GetCachedRichTextParseResult(InText.ToString())->TextContentRange;
 }
 
 TArray<FInt32Range> UJointFunctionLibrary::GetDecoratorSymbolRange(const FText InText)
 {
-	TArray<FInt32Range> OutRange;
+	return GetCachedRichTextParseResult(InText.ToString())->DecoratorSymbolRange;
+}
 
-	//First, grab the content range.
-	TArray<FInt32Range> ContentRange = GetTextContentRange(InText);
+TArray<FInt32Range> UJointFunctionLibrary::GetDecoratedTextContentRange(const FText InText)
+{
+	return GetCachedRichTextParseResult(InText.ToString())->DecoratedTextContentRange;
+}
 
-	int LastSeenRangeEnd = 0;
+TSharedRef<const FJointRichTextParseResult, ESPMode::ThreadSafe> UJointFunctionLibrary::GetCachedRichTextParseResult(const FString& SourceString)
+{
+	JointRichTextParseCache::FCache& Cache = JointRichTextParseCache::Get();
+
+	const JointRichTextParseCache::FKey Key(SourceString, FInternationalization::Get().GetCurrentCulture()->GetName());
 
-	//And subtract from the original range.
-	for (FInt32Range Range : ContentRange)
 	{
-		//If the doesn't start from the 0, add it to the array.
-		if (Range.GetLowerBound().GetValue() != 0)
+		FScopeLock Lock(&Cache.Mutex);
+
+		if (const JointRichTextParseCache::FResultRef* Found = Cache.Results.FindAndTouch(Key))
 		{
-			OutRange.Add(FInt32Range(LastSeenRangeEnd, Range.GetLowerBound().GetValue() - 1));
+			++Cache.Hits;
+
+			return *Found;
 		}
 
-		LastSeenRangeEnd = Range.GetUpperBound().GetValue() - 1;
+		++Cache.Misses;
 	}
 
-	//Add the tail part if it doesn't end with content.
-	if (LastSeenRangeEnd != InText.ToString().Len() - 1)
+	//Parse it outside of the lock - the other threads can keep using the cache meanwhile.
+	TSharedRef<FJointRichTextParseResult, ESPMode::ThreadSafe> NewResult = MakeShared<FJointRichTextParseResult, ESPMode::ThreadSafe>();
+
+	ParseRichTextRanges(SourceString, NewResult.Get());
+
 	{
-		OutRange.Add(FInt32Range(LastSeenRangeEnd, InText.ToString().Len() - 1));
+		FScopeLock Lock(&Cache.Mutex);
+
+		Cache.Results.Add(Key, NewResult);
 	}
 
-	return OutRange;
+	return NewResult;
 }
 
-TArray<FInt32Range> UJointFunctionLibrary::GetDecoratedTextContentRange(const FText InText)
+void UJointFunctionLibrary::GetRichTextParseCacheStats(int64& OutHits, int64& OutMisses, int32& OutNum, int32& OutCapacity)
+{
+	JointRichTextParseCache::FCache& Cache = JointRichTextParseCache::Get();
+
+	FScopeLock Lock(&Cache.Mutex);
+
+	OutHits = Cache.Hits;
+	OutMisses = Cache.Misses;
+	OutNum = Cache.Results.Num();
+	OutCapacity = Cache.Results.Max();
+}
+
+void UJointFunctionLibrary::ResetRichTextParseCache(const int32 NewCapacity)
+{
+	JointRichTextParseCache::FCache& Cache = JointRichTextParseCache::Get();
+
+	FScopeLock Lock(&Cache.Mutex);
+
+	Cache.Results.Empty(NewCapacity > 0 ? NewCapacity : Cache.Results.Max());
+
+	Cache.Hits = 0;
+	Cache.Misses = 0;
+}
+
+void UJointFunctionLibrary::ParseRichTextRanges(const FString& SourceString, FJointRichTextParseResult& OutResult)
 {
-	TArray<FInt32Range> OutRange;
+	OutResult.TextContentRange.Reset();
+	OutResult.DecoratedTextContentRange.Reset();
+	OutResult.DecoratorSymbolRange.Reset();
 
 	const TSharedRef<FDefaultRichTextMarkupParser> Parser = FDefaultRichTextMarkupParser::Create();
 
@@ -119,7 +189,7 @@ TArray<FInt32Range> UJointFunctionLibrary::GetDecoratedTextContentRange(const FT
 
 	FString OutputString;
 
-	Parser->Process(Results, InText.ToString(), OutputString);
+	Parser->Process(Results, SourceString, OutputString);
 
 	int LineIndex = 0;
 
@@ -130,16 +200,41 @@ TArray<FInt32Range> UJointFunctionLibrary::GetDecoratedTextContentRange(const FT
 			if (Run.ContentRange.Len() != 0)
 			{
 				FInt32Range Range = FInt32Range(Run.ContentRange.BeginIndex + LineIndex * 2,
-												Run.ContentRange.EndIndex + 1 + LineIndex * 2);
+				                                Run.ContentRange.EndIndex + 1 + LineIndex * 2);
+
+				OutResult.TextContentRange.Add(Range);
+				OutResult.DecoratedTextContentRange.Add(Range);
+			}else if(Run.Name == "" && Run.OriginalRange.Len() != 0) // if this is an empty run...
+			{
+				FInt32Range Range = FInt32Range(Run.OriginalRange.BeginIndex + LineIndex * 2,
+											Run.OriginalRange.EndIndex + 1 + LineIndex * 2);
 
-				OutRange.Add(Range);
+				OutResult.TextContentRange.Add(Range);
 			}
 		}
 
 		LineIndex++;
 	}
 
-	return OutRange;
+	//The decorator symbol ranges are the complement of the content ranges.
+	int LastSeenRangeEnd = 0;
+
+	for (const FInt32Range& Range : OutResult.TextContentRange)
+	{
+		//If the doesn't start from the 0, add it to the array.
+		if (Range.GetLowerBound().GetValue() != 0)
+		{
+			OutResult.DecoratorSymbolRange.Add(FInt32Range(LastSeenRangeEnd, Range.GetLowerBound().GetValue() - 1));
+		}
+
+		LastSeenRangeEnd = Range.GetUpperBound().GetValue() - 1;
+	}
+
+	//Add the tail part if it doesn't end with content.
+	if (LastSeenRangeEnd != SourceString.Len() - 1)
+	{
+		OutResult.DecoratorSymbolRange.Add(FInt32Range(LastSeenRangeEnd, SourceString.Len() - 1));
+	}
 }
 
 
@@ -155,38 +250,210 @@ FText UJointFunctionLibrary::FormatTextWithMap(FText InText, TMap<FString, FText
 	return FText::Format(InText, FormatArgs);
 }
 
-UDataTable* UJointFunctionLibrary::MergeTextStyleDataTables(TSet<UDataTable*> TablesToMerge)
+namespace JointMergedTextStyleTableCache
 {
-	UDataTable* NewTable = nullptr;
+	struct FEntry
+	{
+	public:
 
-	NewTable = NewObject<UDataTable>();
-	NewTable->RowStruct = FRichTextStyleRow::StaticStruct();
+		~FEntry()
+		{
+			for (const TPair<TWeakObjectPtr<UDataTable>, FDelegateHandle>& Binding : ChangeBindings)
+			{
+				if (UDataTable* SourceTable = Binding.Key.Get()) SourceTable->OnDataTableChanged().Remove(Binding.Value);
+			}
+		}
+
+	public:
+
+		TStrongObjectPtr<UDataTable> MergedTable;
+
+		TSharedRef<const TMap<FName, FTextBlockStyle>> StyleLookup = MakeShared<TMap<FName, FTextBlockStyle>>();
+
+		TArray<TPair<TWeakObjectPtr<UDataTable>, FDelegateHandle>> ChangeBindings;
+	};
+
+	struct FKey
+	{
+	public:
+
+		bool operator==(const FKey& Other) const
+		{
+			return Tables == Other.Tables;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			uint32 Hash = 0;
+
+			for (const TWeakObjectPtr<UDataTable>& Table : Key.Tables) Hash = HashCombine(Hash, GetTypeHash(Table));
+
+			return Hash;
+		}
+
+	public:
+
+		//The source tables in the merge order.
+		TArray<TWeakObjectPtr<UDataTable>> Tables;
+	};
+
+	TMap<FKey, TUniquePtr<FEntry>>& GetEntries()
+	{
+		static TMap<FKey, TUniquePtr<FEntry>> Entries;
+
+		return Entries;
+	}
+
+	FKey MakeKey(const TSet<UDataTable*>& Tables)
+	{
+		FKey Key;
+		Key.Tables.Reserve(Tables.Num());
+
+		//The order matters - the first table wins on the redundant row names.
+		for (UDataTable* Table : Tables)
+		{
+			if (Table) Key.Tables.Add(Table);
+		}
+
+		return Key;
+	}
+
+	void Invalidate(const FKey& Key)
+	{
+		GetEntries().Remove(Key);
+	}
+
+	//Drop the merged sets that have been built from the provided table. Used when the table has been edited or reimported.
+	void InvalidateEntriesOf(const UDataTable* Table)
+	{
+		for (auto It = GetEntries().CreateIterator(); It; ++It)
+		{
+			if (It.Key().Tables.Contains(Table)) It.RemoveCurrent();
+		}
+	}
+
+	//Drop the merged sets that have lost any of their source tables to the garbage collection, so they don't stay in the cache forever.
+	void RemoveStaleEntries()
+	{
+		for (auto It = GetEntries().CreateIterator(); It; ++It)
+		{
+			if (It.Key().Tables.ContainsByPredicate([](const TWeakObjectPtr<UDataTable>& Table) { return !Table.IsValid(); })) It.RemoveCurrent();
+		}
+	}
+
+	FDelegateHandle PostGarbageCollectHandle;
 
-	static const FString ContextString(TEXT("UJointFunctionLibrary::MergeTextStyleDataTables"));
+#if WITH_EDITOR
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
 
-	TSet<FName> AddedNames;
+	void RegisterCleanUpDelegates()
+	{
+		if (PostGarbageCollectHandle.IsValid()) return;
+
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&RemoveStaleEntries);
 
-	AddedNames.Empty();
+#if WITH_EDITOR
+		//Reimports and the property edits on the table end up here, even when the table doesn't broadcast OnDataTableChanged for them.
+		ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject* Object, FPropertyChangedEvent&)
+		{
+			if (const UDataTable* Table = Cast<UDataTable>(Object)) InvalidateEntriesOf(Table);
+		});
+#endif
+	}
+
+	void UnregisterCleanUpDelegates()
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		PostGarbageCollectHandle.Reset();
+
+#if WITH_EDITOR
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+		ObjectPropertyChangedHandle.Reset();
+#endif
+	}
 
-	for (UDataTable* Table : TablesToMerge)
+	FEntry& FindOrBuild(const TSet<UDataTable*>& Tables)
 	{
-		if (Table == nullptr) continue;
+		check(IsInGameThread());
 
-		TArray<FName> RowNames = Table->GetRowNames();
+		TMap<FKey, TUniquePtr<FEntry>>& Entries = GetEntries();
 
-		for (FName RowName : RowNames)
+		const FKey Key = MakeKey(Tables);
+
+		if (TUniquePtr<FEntry>* Found = Entries.Find(Key)) return *Found->Get();
+
+		RegisterCleanUpDelegates();
+
+		TUniquePtr<FEntry> NewEntry = MakeUnique<FEntry>();
+
+		UDataTable* NewTable = NewObject<UDataTable>();
+		NewTable->RowStruct = FRichTextStyleRow::StaticStruct();
+
+		TMap<FName, FTextBlockStyle> StyleLookup;
+
+		static const FString ContextString(TEXT("UJointFunctionLibrary::MergeTextStyleDataTables"));
+
+		for (const TWeakObjectPtr<UDataTable>& WeakTable : Key.Tables)
 		{
-			FRichTextStyleRow* Row = Table->FindRow<FRichTextStyleRow>(RowName, ContextString);
+			UDataTable* Table = WeakTable.Get();
+
+			if (Table == nullptr) continue;
 
-			if (!AddedNames.Contains(RowName))
+			for (const TPair<FName, uint8*>& RowPair : Table->GetRowMap())
 			{
-				NewTable->AddRow(RowName, *Row);
-				AddedNames.Add(RowName);
+				if (StyleLookup.Contains(RowPair.Key)) continue;
+
+				const FRichTextStyleRow* Row = Table->FindRow<FRichTextStyleRow>(RowPair.Key, ContextString);
+
+				if (Row == nullptr) continue;
+
+				NewTable->AddRow(RowPair.Key, *Row);
+				StyleLookup.Add(RowPair.Key, Row->TextStyle);
 			}
+
+			//Rebuild the merged set on the next query when any of the source tables gets changed.
+			NewEntry->ChangeBindings.Emplace(Table, Table->OnDataTableChanged().AddLambda([Key]()
+			{
+				Invalidate(Key);
+			}));
 		}
+
+		NewEntry->MergedTable.Reset(NewTable);
+		NewEntry->StyleLookup = MakeShared<TMap<FName, FTextBlockStyle>>(MoveTemp(StyleLookup));
+
+		return *Entries.Add(Key, MoveTemp(NewEntry)).Get();
+	}
+}
+
+UDataTable* UJointFunctionLibrary::MergeTextStyleDataTables(TSet<UDataTable*> TablesToMerge)
+{
+	return JointMergedTextStyleTableCache::FindOrBuild(TablesToMerge).MergedTable.Get();
+}
+
+bool UJointFunctionLibrary::FindMergedTextStyle(const TSet<UDataTable*>& TablesToMerge, const FName RowName, FTextBlockStyle& OutTextStyle)
+{
+	if (const FTextBlockStyle* Found = JointMergedTextStyleTableCache::FindOrBuild(TablesToMerge).StyleLookup->Find(RowName))
+	{
+		OutTextStyle = *Found;
+
+		return true;
 	}
 
-	return NewTable;
+	return false;
+}
+
+TSharedRef<const TMap<FName, FTextBlockStyle>> UJointFunctionLibrary::GetMergedTextStyleLookup(const TSet<UDataTable*>& TablesToMerge)
+{
+	return JointMergedTextStyleTableCache::FindOrBuild(TablesToMerge).StyleLookup;
+}
+
+void UJointFunctionLibrary::ClearMergedTextStyleTableCache()
+{
+	JointMergedTextStyleTableCache::GetEntries().Empty();
+
+	//They will be registered again with the next merged set.
+	JointMergedTextStyleTableCache::UnregisterCleanUpDelegates();
 }
 
 TArray<FJointEdPinData> UJointFunctionLibrary::ImplementPins(const TArray<FJointEdPinData>& ExistingPins,const TArray<FJointEdPinData>& NeededPinSignature)
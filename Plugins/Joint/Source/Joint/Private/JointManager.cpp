@@ -8,8 +8,11 @@
 #include "Engine/ActorChannel.h"
 #include "Net/UnrealNetwork.h"
 #include "Node/JointNodeBase.h"
+#include "SharedType/JointAssetRegistryTags.h"
 #include "UObject/ObjectSaveContext.h"
 #include "UObject/UObjectIterator.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
 
 UJointManager::UJointManager()
 {
@@ -22,8 +25,92 @@ AJointActor* UJointManager::GetHostingJointActor() const
 	return GetOuter() ? Cast<AJointActor>(GetOuter()) : nullptr;
 }
 
+bool UJointManager::HasBakedGraph() const
+{
+#if WITH_EDITOR
+	//The assets can be edited after the bake. The copies the Joint actors play are not.
+	if (GIsEditor && GetHostingJointActor() == nullptr) return false;
+#endif
+
+	return BakedGraph.IsBaked();
+}
+
+const FJointBakedGraph& UJointManager::GetBakedGraph() const
+{
+	return BakedGraph;
+}
+
+#if WITH_EDITOR
+
+static TAutoConsoleVariable<int32> CVarJointBakeOnPlayInEditor(
+	TEXT("Joint.BakedGraph.BakeOnPlayInEditor"),
+	0,
+	TEXT("Whether to bake the graphs of the Joint managers the Joint actors play in the editor (PIE), so the baked graph can be tested without cooking."));
+
+void UJointManager::BakeGraphForPlayInEditor()
+{
+	if (CVarJointBakeOnPlayInEditor.GetValueOnGameThread() == 0 || GetHostingJointActor() == nullptr) return;
+
+	//The baked graph uses the successor table of the reachability analysis as its edges.
+	UpdateReachability();
+
+	BakedGraph = FJointBakedGraph::Bake(this);
+}
+
+#endif
+
+bool UJointManager::HasReachability() const
+{
+#if WITH_EDITOR
+	//The table can be older than the nodes in the editor, unless it has been analyzed for the PIE together with the bake.
+	if (GIsEditor && !HasBakedGraph()) return false;
+#endif
+
+	return Reachability.IsValid();
+}
+
+const FJointReachability& UJointManager::GetReachability() const
+{
+	return Reachability;
+}
+
+bool UJointManager::CanReachNode(FGuid FromNodeGuid, FGuid ToNodeGuid) const
+{
+	return Reachability.CanReach(FromNodeGuid, ToNodeGuid);
+}
+
+#if WITH_EDITOR
+
+void UJointManager::UpdateReachability()
+{
+	Reachability = FJointReachability::Analyze(this);
+}
+
+bool UJointManager::ShouldStripNodeOnCook(const UJointNodeBase* Node) const
+{
+	if (!bStripUnreachableNodesOnCook || !IsRunningCookCommandlet() || Node == nullptr || !Reachability.IsValid()) return false;
+
+	const int32 NodeIndex = Reachability.FindNodeIndex(Node->GetNodeGuid());
+
+	//Keep the nodes the analysis doesn't know about.
+	return NodeIndex != INDEX_NONE && !Reachability.IsNodeLive(NodeIndex);
+}
+
+#endif
+
 UJointNodeBase* UJointManager::FindBaseNodeWithGuid(FGuid NodeGuid) const
 {
+	if (HasBakedGraph())
+	{
+		const int32 NodeIndex = BakedGraph.FindNodeIndex(NodeGuid);
+
+		if (NodeIndex == INDEX_NONE) return nullptr;
+
+		const FJointBakedNode& BakedNode = BakedGraph.GetNode(NodeIndex);
+
+		return BakedNode.ParentIndex == INDEX_NONE && !BakedNode.bIsManagerFragment ? BakedGraph.GetNodeObject(NodeIndex) : nullptr;
+	}
+
 	for (UJointNodeBase* Node : Nodes)
 	{
 		if (Node == nullptr) continue;
@@ -37,6 +124,11 @@ UJointNodeBase* UJointManager::FindBaseNodeWithGuid(FGuid NodeGuid) const
 
 UJointFragment* UJointManager::FindFragmentWithGuid(FGuid NodeGuid) const
 {
+	if (HasBakedGraph())
+	{
+		return Cast<UJointFragment>(BakedGraph.GetNodeObject(BakedGraph.FindNodeIndex(NodeGuid)));
+	}
+
 	TArray<UJointFragment*> AllManagerFragments = GetAllManagerFragmentsOnLowerHierarchy();
 
 	for (UJointFragment* ManagerFragment : AllManagerFragments)
@@ -485,6 +577,28 @@ void UJointManager::PostEditChangeProperty(struct FPropertyChangedEvent& Propert
 	FCoreUObjectDelegates::OnObjectPropertyChanged.Broadcast(this, EmptyPropertyChangedEvent);
 }
 
+void UJointManager::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	//Keep the reachability table up to date with the saved nodes. The nodes will be stripped on the cook by this table, and the baked graph uses it as its edges.
+	UpdateReachability();
+
+	//Only the cooked data carries the baked graph. The editor data is always the node objects themselves.
+	if (!SaveContext.IsCooking())
+	{
+		BakedGraph.Reset();
+
+		return;
+	}
+
+	const double BakeStartTime = FPlatformTime::Seconds();
+
+	BakedGraph = FJointBakedGraph::Bake(this, SaveContext.GetTargetPlatform());
+
+	FJointBakedGraphCookReport::Write(this, BakedGraph, SaveContext.GetTargetPlatform(), FPlatformTime::Seconds() - BakeStartTime);
+}
+
 #endif
 
 void UJointManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -528,3 +642,30 @@ void UJointManager::Serialize(FArchive& Ar)
 {
 	UObject::Serialize(Ar);
 }
+
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+
+void UJointManager::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
+{
+	Super::GetAssetRegistryTags(OutTags);
+
+	FJointAssetRegistryTags::Gather(this, OutTags);
+}
+
+#else
+
+void UJointManager::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	TArray<FAssetRegistryTag> Tags;
+
+	FJointAssetRegistryTags::Gather(this, Tags);
+
+	for (const FAssetRegistryTag& Tag : Tags)
+	{
+		Context.AddTag(Tag);
+	}
+}
+
+#endif
@@ -6,13 +6,13 @@ UJN_Foundation::UJN_Foundation()
 {
 }
 
-TArray<UJointNodeBase*> UJN_Foundation::SelectNextNodes_Implementation(AJointActor* InHostingJointInstance)
+bool UJN_Foundation::NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes)
 {
-	TArray<UJointNodeBase*> Nodes = Super::SelectNextNodes_Implementation(InHostingJointInstance);
-
-	if(!Nodes.IsEmpty()) return Nodes;
+	if(Super::NativeSelectNextNodes(InHostingJointInstance, OutNodes)) return true;
 	
-	return NextNode;
+	OutNodes.Append(NextNode);
+
+	return !NextNode.IsEmpty();
 }
 
 bool UJN_Foundation::IsSupportedForNetworking() const
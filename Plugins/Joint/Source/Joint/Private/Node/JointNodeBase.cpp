@@ -12,6 +12,8 @@
 #include "Engine/NetDriver.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/BlueprintGeneratedClass.h"
+#include "UObject/UnrealType.h"
+#include "UObject/ObjectKey.h"
 #include "Engine/Engine.h"
 #include "Interfaces/ITargetPlatform.h"
 #include "Kismet/GameplayStatics.h"
@@ -158,23 +160,29 @@ bool UJointNodeBase::NeedsLoadForClient() const
 	
 	if(!UObject::NeedsLoadForClient()) return false;
 
+	// Joint 2.12.0 : The decisions are memoized while cooking, so the parent chain & the preset will be evaluated only once per node.
+
+	FJointBuildPresetCache& PresetCache = FJointBuildPresetCache::Get();
+
+	bool bAllowed = true;
+
+	if(PresetCache.FindNodeDecision(this, EJointBuildPresetQuery::Client, nullptr, bAllowed)) return bAllowed;
+
 	// If parent node will not be loaded for the target, it will be excluded as well.
+	// If no preset is provided, it will be included always. Otherwise, it will follow the preset.
 
-	if(ParentNode && !ParentNode->NeedsLoadForClient()) return false;
-	
-	// If no preset is provided, it will be included always.
-	
-	if(BuildPreset.IsNull()) return true;
+	bAllowed = !(ParentNode && !ParentNode->NeedsLoadForClient()) && PresetCache.Allows(BuildPreset, EJointBuildPresetQuery::Client) && !IsStrippedAsUnreachableOnCook();
 
-	if(UJointBuildPreset* Preset = BuildPreset.LoadSynchronous()) // If no preset is provided, it will follow the preset.
-	{
-		return Preset->AllowForClient();
-	}
+	PresetCache.StoreNodeDecision(this, EJointBuildPresetQuery::Client, nullptr, bAllowed);
 
-#endif
+	return bAllowed;
+
+#else
 
 	return true;
 
+#endif
+
 }
 
 bool UJointNodeBase::NeedsLoadForServer() const
@@ -186,22 +194,26 @@ bool UJointNodeBase::NeedsLoadForServer() const
 
 	if(!UObject::NeedsLoadForServer()) return false;
 
-	// If parent node will not be loaded for the target, it will be excluded as well.
+	FJointBuildPresetCache& PresetCache = FJointBuildPresetCache::Get();
+
+	bool bAllowed = true;
 
-	if(ParentNode && !ParentNode->NeedsLoadForServer()) return false;
+	if(PresetCache.FindNodeDecision(this, EJointBuildPresetQuery::Server, nullptr, bAllowed)) return bAllowed;
 
+	// If parent node will not be loaded for the target, it will be excluded as well.
 	// If no preset is provided, it will be included always.
-		
-	if(BuildPreset.IsNull()) return true;
 
-	if(UJointBuildPreset* Preset = BuildPreset.LoadSynchronous())
-	{
-		return Preset->AllowForServer();
-	}
+	bAllowed = !(ParentNode && !ParentNode->NeedsLoadForServer()) && PresetCache.Allows(BuildPreset, EJointBuildPresetQuery::Server) && !IsStrippedAsUnreachableOnCook();
+
+	PresetCache.StoreNodeDecision(this, EJointBuildPresetQuery::Server, nullptr, bAllowed);
+
+	return bAllowed;
+
+#else
 
-#endif
-	
 	return true;
+
+#endif
 }
 
 bool UJointNodeBase::NeedsLoadForTargetPlatform(const ITargetPlatform* TargetPlatform) const
@@ -209,26 +221,43 @@ bool UJointNodeBase::NeedsLoadForTargetPlatform(const ITargetPlatform* TargetPla
 
 #if WITH_EDITOR
 
-	// If parent node will not be loaded for the target, it will be excluded as well.
+	FJointBuildPresetCache& PresetCache = FJointBuildPresetCache::Get();
+
+	bool bAllowed = true;
 
-	if(ParentNode && !ParentNode->NeedsLoadForTargetPlatform(TargetPlatform)) return false;
+	if(PresetCache.FindNodeDecision(this, EJointBuildPresetQuery::BuildTarget, TargetPlatform, bAllowed)) return bAllowed;
 
+	// If parent node will not be loaded for the target, it will be excluded as well.
 	// If no preset is provided, it will be included always.
 
-	if(BuildPreset.IsNull()) return true;
+	bAllowed = !(ParentNode && !ParentNode->NeedsLoadForTargetPlatform(TargetPlatform)) && PresetCache.Allows(BuildPreset, EJointBuildPresetQuery::BuildTarget, TargetPlatform) && !IsStrippedAsUnreachableOnCook();
 
-	if(UJointBuildPreset* Preset = BuildPreset.LoadSynchronous())
-	{
-		return Preset->AllowForBuildTarget(TargetPlatform);
-	}
+	PresetCache.StoreNodeDecision(this, EJointBuildPresetQuery::BuildTarget, TargetPlatform, bAllowed);
 
-#endif
-	
+	return bAllowed;
+
+#else
 
 	return true;
 
+#endif
+
 }
 
+#if WITH_EDITOR
+
+bool UJointNodeBase::IsStrippedAsUnreachableOnCook() const
+{
+	//Only the base nodes are on the reachability table. The fragments follow their parent nodes.
+	if (ParentNode != nullptr) return false;
+
+	const UJointManager* Manager = GetJointManager();
+
+	return Manager != nullptr && Manager->ShouldStripNodeOnCook(this);
+}
+
+#endif
+
 void UJointNodeBase::OnPinConnectionChanged_Implementation(const TMap<FJointEdPinData, FJointNodes>& PinToConnections)
 {
 	//Do whatever you want if you need. Especially when you don't want to mess up with the editor nodes.
@@ -690,8 +719,95 @@ TArray<UJointFragment*> UJointNodeBase::GetAllFragments() const
 	return FinalArray;
 }
 
-TArray<UJointNodeBase*> UJointNodeBase::SelectNextNodes_Implementation(
-	AJointActor* InHostingJointInstance)
+namespace JointNodeDeprecatedSelection
+{
+	//The node the default NativeSelectNextNodes() is going through SelectNextNodes_Implementation() for. The default implementation of it must not come back.
+	const UJointNodeBase* SelectingNode = nullptr;
+
+	//Set by the default SelectNextNodes_Implementation() while a class is probed. See UObject::ImplementsGetWorld() for the same approach.
+	bool bDefaultImplementationReached = false;
+
+	int32 DefaultSelectionNum = 0;
+
+	//Whether the C++ classes override SelectNextNodes_Implementation(). A class doesn't change its overrides, and a hot reloaded class is a new class object with a new key.
+	TMap<FObjectKey, bool>& GetOverriddenClasses()
+	{
+		static TMap<FObjectKey, bool> OverriddenClasses;
+
+		return OverriddenClasses;
+	}
+}
+
+PRAGMA_DISABLE_DEPRECATION_WARNINGS
+
+TArray<UJointNodeBase*> UJointNodeBase::SelectNextNodes_Implementation(AJointActor* InHostingJointInstance)
+{
+	FJointNodeSelection Nodes;
+
+	//Called back from the default NativeSelectNextNodes() - don't go back to the native overrides again.
+	if (JointNodeDeprecatedSelection::SelectingNode == this)
+	{
+		SelectNextNodesFromSubNodes(InHostingJointInstance, Nodes);
+
+		JointNodeDeprecatedSelection::bDefaultImplementationReached = true;
+		JointNodeDeprecatedSelection::DefaultSelectionNum = Nodes.Num();
+	}
+	else
+	{
+		NativeSelectNextNodes(InHostingJointInstance, Nodes);
+	}
+
+	return TArray<UJointNodeBase*>(Nodes);
+}
+
+PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+bool UJointNodeBase::SelectNextNodesInto(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes)
+{
+	//Only the blueprint overrides need the event. Everything else can stay native.
+	if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UJointNodeBase, SelectNextNodes)))
+	{
+		const TArray<UJointNodeBase*> Nodes = SelectNextNodes(InHostingJointInstance);
+
+		OutNodes.Append(Nodes);
+
+		return !Nodes.IsEmpty();
+	}
+
+	return NativeSelectNextNodes(InHostingJointInstance, OutNodes);
+}
+
+bool UJointNodeBase::NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes)
+{
+	const bool* bIsOverridden = IsInGameThread() ? JointNodeDeprecatedSelection::GetOverriddenClasses().Find(GetClass()) : nullptr;
+
+	//The most of the classes don't override SelectNextNodes_Implementation() at all. Don't allocate the array of it for them.
+	if (bIsOverridden && !*bIsOverridden) return SelectNextNodesFromSubNodes(InHostingJointInstance, OutNodes);
+
+	TGuardValue<const UJointNodeBase*> SelectingNodeGuard(JointNodeDeprecatedSelection::SelectingNode, this);
+	TGuardValue<bool> DefaultReachedGuard(JointNodeDeprecatedSelection::bDefaultImplementationReached, false);
+	TGuardValue<int32> DefaultSelectionNumGuard(JointNodeDeprecatedSelection::DefaultSelectionNum, 0);
+
+	PRAGMA_DISABLE_DEPRECATION_WARNINGS
+
+	const TArray<UJointNodeBase*> Nodes = SelectNextNodes_Implementation(InHostingJointInstance);
+
+	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+	//Probe the class on its first selection. An override that only passes the default selection through is treated as not overridden.
+	if (bIsOverridden == nullptr && IsInGameThread())
+	{
+		JointNodeDeprecatedSelection::GetOverriddenClasses().Add(
+			GetClass(),
+			!JointNodeDeprecatedSelection::bDefaultImplementationReached || JointNodeDeprecatedSelection::DefaultSelectionNum != Nodes.Num());
+	}
+
+	OutNodes.Append(Nodes);
+
+	return !Nodes.IsEmpty();
+}
+
+bool UJointNodeBase::SelectNextNodesFromSubNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes)
 {
 	for (UJointNodeBase* SubNode : SubNodes)
 	{
@@ -700,11 +816,152 @@ TArray<UJointNodeBase*> UJointNodeBase::SelectNextNodes_Implementation(
 		if(!SubNode->IsNodeBegunPlay()) continue;
 
 		//Test through the sub nodes and if it has something then use that.
-		TArray<UJointNodeBase*> Nodes = SubNode->SelectNextNodes(InHostingJointInstance);
-		if (!Nodes.IsEmpty()) return Nodes;
+		if (SubNode->SelectNextNodesInto(InHostingJointInstance, OutNodes)) return true;
+	}
+
+	return false;
+}
+
+namespace JointNodeLookAhead
+{
+	bool IsNodeClass(const UClass* InClass)
+	{
+		return InClass != nullptr && InClass->IsChildOf(UJointNodeBase::StaticClass());
+	}
+
+	//The properties of UJointNodeBase itself are the hierarchy & settings of the node (ParentNode, SubNodes, BuildPreset...), not the data of the node.
+	bool IsNodeDataProperty(const FProperty* Property)
+	{
+		return Property != nullptr && Property->GetOwnerClass() != UJointNodeBase::StaticClass() && !Property->IsEditorOnlyProperty();
+	}
+
+	void AddPossibleNextNode(UJointNodeBase* Candidate, const UJointNodeBase* ParentmostNode, TArray<UJointNodeBase*>& OutNodes)
+	{
+		if (Candidate == nullptr) return;
+
+		UJointNodeBase* CandidateBaseNode = Candidate->GetParentmostNode();
+
+		if (CandidateBaseNode == nullptr || CandidateBaseNode == ParentmostNode) return;
+
+		OutNodes.AddUnique(CandidateBaseNode);
+	}
+
+	void CollectNodesFromProperties(UJointNodeBase* Node, const UJointNodeBase* ParentmostNode, TArray<UJointNodeBase*>& OutNodes)
+	{
+		for (TFieldIterator<FProperty> It(Node->GetClass()); It; ++It)
+		{
+			const FProperty* Property = *It;
+
+			if (!IsNodeDataProperty(Property)) continue;
+
+			if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+			{
+				if (!IsNodeClass(ObjectProperty->PropertyClass)) continue;
+
+				for (int32 Index = 0; Index < ObjectProperty->ArrayDim; ++Index)
+				{
+					AddPossibleNextNode(Cast<UJointNodeBase>(ObjectProperty->GetObjectPropertyValue_InContainer(Node, Index)), ParentmostNode, OutNodes);
+				}
+			}
+			else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				const FObjectProperty* InnerProperty = CastField<FObjectProperty>(ArrayProperty->Inner);
+
+				if (InnerProperty == nullptr || !IsNodeClass(InnerProperty->PropertyClass)) continue;
+
+				FScriptArrayHelper_InContainer ArrayHelper(ArrayProperty, Node);
+
+				for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+				{
+					AddPossibleNextNode(Cast<UJointNodeBase>(InnerProperty->GetObjectPropertyValue(ArrayHelper.GetRawPtr(Index))), ParentmostNode, OutNodes);
+				}
+			}
+		}
 	}
 
-	return TArray<UJointNodeBase*>();
+	void AddAssetPath(const FSoftObjectPtr* SoftObjectPtr, TArray<FSoftObjectPath>& OutAssetPaths)
+	{
+		if (SoftObjectPtr == nullptr) return;
+
+		const FSoftObjectPath& Path = SoftObjectPtr->ToSoftObjectPath();
+
+		if (Path.IsNull()) return;
+
+		OutAssetPaths.AddUnique(Path);
+	}
+}
+
+void UJointNodeBase::GetPossibleNextNodes(TArray<UJointNodeBase*>& OutNodes)
+{
+	UJointNodeBase* ParentmostNode = GetParentmostNode();
+
+	//Use the successor table of the reachability analysis if the asset has been saved with it.
+	if (const UJointManager* Manager = GetJointManager(); Manager && Manager->HasReachability())
+	{
+		const FJointReachability& Reachability = Manager->GetReachability();
+
+		const int32 NodeIndex = ParentmostNode ? Reachability.FindNodeIndex(ParentmostNode->GetNodeGuid()) : INDEX_NONE;
+
+		if (NodeIndex != INDEX_NONE)
+		{
+			for (const int32 SuccessorIndex : Reachability.GetSuccessorIndices(NodeIndex))
+			{
+				if (UJointNodeBase* NextNode = Reachability.GetNodeObject(SuccessorIndex)) OutNodes.AddUnique(NextNode);
+			}
+
+			return;
+		}
+	}
+
+	CollectPossibleNextNodesFromProperties(OutNodes);
+}
+
+void UJointNodeBase::CollectPossibleNextNodesFromProperties(TArray<UJointNodeBase*>& OutNodes)
+{
+	const UJointNodeBase* ParentmostNode = GetParentmostNode();
+
+	JointNodeLookAhead::CollectNodesFromProperties(this, ParentmostNode, OutNodes);
+
+	for (UJointFragment* Fragment : GetAllFragmentsOnLowerHierarchy())
+	{
+		if (Fragment == nullptr) continue;
+
+		JointNodeLookAhead::CollectNodesFromProperties(Fragment, ParentmostNode, OutNodes);
+	}
+}
+
+void UJointNodeBase::CollectAssetsToPrefetch_Implementation(TArray<FSoftObjectPath>& OutAssetPaths)
+{
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		const FProperty* Property = *It;
+
+		if (!JointNodeLookAhead::IsNodeDataProperty(Property)) continue;
+
+		//FSoftClassProperty is a FSoftObjectProperty as well.
+		if (const FSoftObjectProperty* SoftProperty = CastField<FSoftObjectProperty>(Property))
+		{
+			if (JointNodeLookAhead::IsNodeClass(SoftProperty->PropertyClass)) continue;
+
+			for (int32 Index = 0; Index < SoftProperty->ArrayDim; ++Index)
+			{
+				JointNodeLookAhead::AddAssetPath(SoftProperty->GetPropertyValuePtr_InContainer(this, Index), OutAssetPaths);
+			}
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			const FSoftObjectProperty* InnerProperty = CastField<FSoftObjectProperty>(ArrayProperty->Inner);
+
+			if (InnerProperty == nullptr || JointNodeLookAhead::IsNodeClass(InnerProperty->PropertyClass)) continue;
+
+			FScriptArrayHelper_InContainer ArrayHelper(ArrayProperty, this);
+
+			for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+			{
+				JointNodeLookAhead::AddAssetPath(InnerProperty->GetPropertyValuePtr(ArrayHelper.GetRawPtr(Index)), OutAssetPaths);
+			}
+		}
+	}
 }
 
 bool UJointNodeBase::IsNodeBegunPlay() const
@@ -1015,6 +1272,8 @@ void UJointNodeBase::ProcessPreNodeBeginPlay()
 
 	PreNodeBeginPlay();
 	
+	OnJointNodeBeginNative.Broadcast(this);
+
 	if (OnJointNodeBeginDelegate.IsBound())
 	{
 		OnJointNodeBeginDelegate.Broadcast(this);
@@ -1047,6 +1306,8 @@ void UJointNodeBase::ProcessPreNodeEndPlay()
 	PreNodeEndPlay();
 	
 	//Broadcast OnJointNodeEndDelegate Action.
+	OnJointNodeEndNative.Broadcast(this);
+
 	if (OnJointNodeEndDelegate.IsBound())
 	{
 		OnJointNodeEndDelegate.Broadcast(this);
@@ -1076,6 +1337,8 @@ void UJointNodeBase::ProcessPreMarkNodePending()
 	PreNodeMarkedAsPending();
 
 	//Broadcast OnJointNodeMarkedAsPendingDelegate Action.
+	OnJointNodeMarkedAsPendingNative.Broadcast(this);
+
 	if (OnJointNodeMarkedAsPendingDelegate.IsBound())
 	{
 		OnJointNodeMarkedAsPendingDelegate.Broadcast(this);
@@ -1191,6 +1454,10 @@ void UJointNodeBase::PreNodeMarkedAsPending_Implementation()
 {
 }
 
+void UJointNodeBase::PostNodeProgressRestored_Implementation()
+{
+}
+
 TSoftObjectPtr<UJointBuildPreset> UJointNodeBase::GetBuildPreset()
 {
 
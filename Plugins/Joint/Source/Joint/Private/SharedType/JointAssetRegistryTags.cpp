@@ -0,0 +1,188 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "SharedType/JointAssetRegistryTags.h"
+
+#include "GameplayTagContainer.h"
+#include "Joint.h"
+#include "JointManager.h"
+#include "Node/JointFragment.h"
+#include "Node/JointNodeBase.h"
+#include "UObject/UnrealType.h"
+
+const FName FJointAssetRegistryTags::NodeClasses(TEXT("JointNodeClasses"));
+const FName FJointAssetRegistryTags::FragmentClasses(TEXT("JointFragmentClasses"));
+const FName FJointAssetRegistryTags::NodeCount(TEXT("JointNodeCount"));
+const FName FJointAssetRegistryTags::FragmentCount(TEXT("JointFragmentCount"));
+const FName FJointAssetRegistryTags::GameplayTags(TEXT("JointGameplayTags"));
+const FName FJointAssetRegistryTags::SoftReferences(TEXT("JointSoftReferences"));
+const FName FJointAssetRegistryTags::EditorNodeClasses(TEXT("JointEditorNodeClasses"));
+const FName FJointAssetRegistryTags::NodeClassPackages(TEXT("JointNodeClassPackages"));
+const FName FJointAssetRegistryTags::NativeNodeClasses(TEXT("JointNativeNodeClasses"));
+
+const TCHAR* FJointAssetRegistryTags::ListDelimiter = TEXT(",");
+
+
+namespace JointAssetRegistryTags
+{
+	struct FGatherContext
+	{
+		FString OwnerPackageName;
+
+		TSet<FString> GameplayTagNames;
+
+		TSet<FString> SoftReferencePaths;
+	};
+
+	void AddSoftReference(const FSoftObjectPath& Path, FGatherContext& Context)
+	{
+		//The references to the nodes of the Joint manager itself (e.g. FJointNodePointer) say nothing about the asset.
+		if (Path.IsNull() || Path.GetLongPackageName() == Context.OwnerPackageName) return;
+
+		Context.SoftReferencePaths.Add(Path.ToString());
+	}
+
+	//Collect the gameplay tags & the soft object paths the properties of the provided node hold, including the ones in the structs and the containers.
+	void CollectPropertyValues(const UJointNodeBase* Node, FGatherContext& Context)
+	{
+		const UScriptStruct* GameplayTagStruct = FGameplayTag::StaticStruct();
+		const UScriptStruct* GameplayTagContainerStruct = FGameplayTagContainer::StaticStruct();
+		const UScriptStruct* SoftObjectPathStruct = TBaseStructure<FSoftObjectPath>::Get();
+
+		for (TPropertyValueIterator<FProperty> It(Node->GetClass(), Node); It; ++It)
+		{
+			const FProperty* Property = It.Key();
+			const void* Value = It.Value();
+
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (StructProperty->Struct == GameplayTagStruct)
+				{
+					const FGameplayTag* Tag = static_cast<const FGameplayTag*>(Value);
+
+					if (Tag->IsValid()) Context.GameplayTagNames.Add(Tag->ToString());
+				}
+				else if (StructProperty->Struct == GameplayTagContainerStruct)
+				{
+					for (const FGameplayTag& Tag : *static_cast<const FGameplayTagContainer*>(Value))
+					{
+						if (Tag.IsValid()) Context.GameplayTagNames.Add(Tag.ToString());
+					}
+
+					//The parent tags are not referenced by the node.
+					It.SkipRecursiveProperty();
+				}
+				else if (StructProperty->Struct->IsChildOf(SoftObjectPathStruct))
+				{
+					AddSoftReference(*static_cast<const FSoftObjectPath*>(Value), Context);
+
+					It.SkipRecursiveProperty();
+				}
+			}
+			else if (const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property))
+			{
+				AddSoftReference(SoftObjectProperty->GetPropertyValue(Value).ToSoftObjectPath(), Context);
+			}
+		}
+	}
+}
+
+
+void FJointAssetRegistryTags::Gather(const UJointManager* InJointManager, TArray<UObject::FAssetRegistryTag>& OutTags)
+{
+	if (InJointManager == nullptr) return;
+
+	JointAssetRegistryTags::FGatherContext Context;
+
+	Context.OwnerPackageName = InJointManager->GetPackage()->GetName();
+
+	TSet<FString> NodeClassPaths;
+	TSet<FString> FragmentClassPaths;
+
+	int32 NumNodes = 0;
+	int32 NumFragments = 0;
+
+	TSet<const UJointNodeBase*> VisitedNodes;
+
+	auto CollectNode = [&](const UJointNodeBase* Node)
+	{
+		if (Node == nullptr || VisitedNodes.Contains(Node)) return;
+
+		VisitedNodes.Add(Node);
+
+		if (Node->IsA<UJointFragment>())
+		{
+			FragmentClassPaths.Add(Node->GetClass()->GetPathName());
+
+			++NumFragments;
+		}
+		else
+		{
+			NodeClassPaths.Add(Node->GetClass()->GetPathName());
+
+			++NumNodes;
+		}
+
+		JointAssetRegistryTags::CollectPropertyValues(Node, Context);
+	};
+
+	auto CollectHierarchy = [&](UJointNodeBase* Node)
+	{
+		if (Node == nullptr) return;
+
+		CollectNode(Node);
+
+		for (UJointFragment* Fragment : Node->GetAllFragmentsOnLowerHierarchy())
+		{
+			CollectNode(Fragment);
+		}
+	};
+
+	for (UJointNodeBase* Node : InJointManager->Nodes)
+	{
+		CollectHierarchy(Node);
+	}
+
+	for (UJointNodeBase* ManagerFragment : InJointManager->ManagerFragments)
+	{
+		CollectHierarchy(ManagerFragment);
+	}
+
+	OutTags.Add(UObject::FAssetRegistryTag(NodeClasses, MakeList(NodeClassPaths.Array()), UObject::FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(UObject::FAssetRegistryTag(FragmentClasses, MakeList(FragmentClassPaths.Array()), UObject::FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(UObject::FAssetRegistryTag(NodeCount, FString::FromInt(NumNodes), UObject::FAssetRegistryTag::TT_Numerical));
+	OutTags.Add(UObject::FAssetRegistryTag(FragmentCount, FString::FromInt(NumFragments), UObject::FAssetRegistryTag::TT_Numerical));
+	OutTags.Add(UObject::FAssetRegistryTag(GameplayTags, MakeList(Context.GameplayTagNames.Array()), UObject::FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(UObject::FAssetRegistryTag(SoftReferences, MakeList(Context.SoftReferencePaths.Array()), UObject::FAssetRegistryTag::TT_Hidden));
+
+#if WITH_EDITORONLY_DATA
+
+	if (FJointModule* Module = FModuleManager::GetModulePtr<FJointModule>("Joint"); Module != nullptr && Module->OnGatherEditorAssetRegistryTags.IsBound())
+	{
+		Module->OnGatherEditorAssetRegistryTags.Execute(InJointManager, OutTags);
+	}
+
+#endif
+}
+
+FString FJointAssetRegistryTags::MakeList(TArray<FString> Entries)
+{
+	//Keep the value stable between the saves, so the tag doesn't change unless the content does.
+	Entries.Sort();
+
+	return FString::Join(Entries, ListDelimiter);
+}
+
+void FJointAssetRegistryTags::ParseList(const FString& ListValue, TArray<FString>& OutEntries)
+{
+	ListValue.ParseIntoArray(OutEntries, ListDelimiter, true);
+}
+
+bool FJointAssetRegistryTags::ListContains(const FString& ListValue, const FString& Entry)
+{
+	TArray<FString> Entries;
+
+	ParseList(ListValue, Entries);
+
+	return Entries.Contains(Entry);
+}
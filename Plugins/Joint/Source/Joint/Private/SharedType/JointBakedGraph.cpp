@@ -0,0 +1,392 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "SharedType/JointBakedGraph.h"
+
+#include "JointLogChannels.h"
+#include "JointManager.h"
+#include "Node/JointFragment.h"
+#include "Node/JointNodeBase.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_EDITOR
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/ITargetPlatform.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/ObjectResource.h"
+#include "UObject/UObjectHash.h"
+
+#endif
+
+//Bump it whenever the layout of the payload changes. The graphs baked with the other versions will be discarded on the load and must be recooked.
+//The fields that are serialized before the payload (the version, bIsBaked, the node objects and the payload size) must stay the same across the versions.
+#define JOINT_BAKED_GRAPH_VERSION 3
+
+
+FArchive& operator<<(FArchive& Ar, FJointBakedNode& Node)
+{
+	Ar << Node.NodeGuid;
+	Ar << Node.ParentIndex;
+	Ar << Node.LowerHierarchyNum;
+	Ar << Node.TagStart;
+	Ar << Node.TagNum;
+	Ar << Node.bIsManagerFragment;
+
+	return Ar;
+}
+
+
+namespace JointBakedGraph
+{
+	bool ShouldInclude(const UJointNodeBase* Node, const ITargetPlatform* TargetPlatform)
+	{
+		if (Node == nullptr) return false;
+
+#if WITH_EDITOR
+		if (TargetPlatform != nullptr && !Node->NeedsLoadForTargetPlatform(TargetPlatform)) return false;
+#endif
+
+		return true;
+	}
+
+	struct FBakeContext
+	{
+		const ITargetPlatform* TargetPlatform = nullptr;
+
+		TArray<TObjectPtr<UJointNodeBase>>& NodeObjects;
+		TArray<FJointBakedNode>& Nodes;
+		TArray<FGameplayTag>& Tags;
+		TArray<int32>& TagIndices;
+
+		TMap<FGameplayTag, int32> TagToIndex;
+	};
+
+	int32 InternTag(FBakeContext& Context, const FGameplayTag& Tag)
+	{
+		if (const int32* Found = Context.TagToIndex.Find(Tag)) return *Found;
+
+		const int32 NewIndex = Context.Tags.Add(Tag);
+
+		Context.TagToIndex.Add(Tag, NewIndex);
+
+		return NewIndex;
+	}
+
+	//Lay out the node and its lower hierarchy in the depth-first order.
+	void AddNodeRecursive(FBakeContext& Context, UJointNodeBase* Node, const int32 ParentIndex, const bool bIsManagerFragment)
+	{
+		if (!ShouldInclude(Node, Context.TargetPlatform)) return;
+
+		const int32 NodeIndex = Context.Nodes.AddDefaulted();
+
+		Context.NodeObjects.Add(Node);
+
+		{
+			FJointBakedNode& BakedNode = Context.Nodes[NodeIndex];
+
+			BakedNode.NodeGuid = Node->GetNodeGuid();
+			BakedNode.ParentIndex = ParentIndex;
+			BakedNode.bIsManagerFragment = bIsManagerFragment;
+			BakedNode.TagStart = Context.TagIndices.Num();
+		}
+
+		for (const FGameplayTag& Tag : Node->NodeTags)
+		{
+			Context.TagIndices.Add(InternTag(Context, Tag));
+		}
+
+		Context.Nodes[NodeIndex].TagNum = Context.TagIndices.Num() - Context.Nodes[NodeIndex].TagStart;
+
+		for (UJointNodeBase* SubNode : Node->SubNodes)
+		{
+			AddNodeRecursive(Context, SubNode, NodeIndex, bIsManagerFragment);
+		}
+
+		//Don't hold the reference across the recursion above - the array can be reallocated.
+		Context.Nodes[NodeIndex].LowerHierarchyNum = Context.Nodes.Num() - NodeIndex - 1;
+	}
+}
+
+
+FJointBakedGraph FJointBakedGraph::Bake(UJointManager* InJointManager, const ITargetPlatform* TargetPlatform)
+{
+	FJointBakedGraph Graph;
+
+	if (InJointManager == nullptr) return Graph;
+
+	JointBakedGraph::FBakeContext Context{TargetPlatform, Graph.NodeObjects, Graph.Nodes, Graph.Tags, Graph.TagIndices};
+
+	for (UJointNodeBase* Node : InJointManager->Nodes)
+	{
+		//Only the base nodes are laid out from here. Their fragments will follow them.
+		if (Node == nullptr || Node->GetParentNode() != nullptr) continue;
+
+		JointBakedGraph::AddNodeRecursive(Context, Node, INDEX_NONE, false);
+	}
+
+	for (UJointNodeBase* ManagerFragment : InJointManager->ManagerFragments)
+	{
+		JointBakedGraph::AddNodeRecursive(Context, ManagerFragment, INDEX_NONE, true);
+	}
+
+	Graph.RebuildGuidIndex();
+
+	Graph.bIsBaked = true;
+
+	return Graph;
+}
+
+bool FJointBakedGraph::IsBaked() const
+{
+	return bIsBaked;
+}
+
+void FJointBakedGraph::Reset()
+{
+	NodeObjects.Empty();
+	Nodes.Empty();
+	Tags.Empty();
+	TagIndices.Empty();
+	GuidToIndex.Empty();
+
+	bIsBaked = false;
+}
+
+int32 FJointBakedGraph::Num() const
+{
+	return Nodes.Num();
+}
+
+int32 FJointBakedGraph::FindNodeIndex(const FGuid& NodeGuid) const
+{
+	const int32* Found = GuidToIndex.Find(NodeGuid);
+
+	return Found ? *Found : INDEX_NONE;
+}
+
+UJointNodeBase* FJointBakedGraph::GetNodeObject(const int32 NodeIndex) const
+{
+	return NodeObjects.IsValidIndex(NodeIndex) ? NodeObjects[NodeIndex].Get() : nullptr;
+}
+
+const FJointBakedNode& FJointBakedGraph::GetNode(const int32 NodeIndex) const
+{
+	return Nodes[NodeIndex];
+}
+
+TConstArrayView<int32> FJointBakedGraph::GetNodeTagIndices(const int32 NodeIndex) const
+{
+	if (!Nodes.IsValidIndex(NodeIndex)) return TConstArrayView<int32>();
+
+	const FJointBakedNode& Node = Nodes[NodeIndex];
+
+	return TConstArrayView<int32>(TagIndices.GetData() + Node.TagStart, Node.TagNum);
+}
+
+const FGameplayTag& FJointBakedGraph::GetTag(const int32 TagIndex) const
+{
+	return Tags[TagIndex];
+}
+
+SIZE_T FJointBakedGraph::GetAllocatedSize() const
+{
+	return NodeObjects.GetAllocatedSize()
+		+ Nodes.GetAllocatedSize()
+		+ Tags.GetAllocatedSize()
+		+ TagIndices.GetAllocatedSize()
+		+ GuidToIndex.GetAllocatedSize();
+}
+
+bool FJointBakedGraph::Serialize(FArchive& Ar)
+{
+	int32 Version = JOINT_BAKED_GRAPH_VERSION;
+
+	Ar << Version;
+	Ar << bIsBaked;
+
+	//The object references stay on the archive itself, so they will be resolved (and remapped on the duplication) as usual.
+	Ar << NodeObjects;
+
+	//The rest of the tables go in one blob, so a blob of the other versions can be skipped without knowing its layout.
+	TArray<uint8> Payload;
+
+	if (Ar.IsSaving() && bIsBaked)
+	{
+		FMemoryWriter Writer(Payload);
+
+		SerializePayload(Writer);
+	}
+
+	Payload.BulkSerialize(Ar);
+
+	if (!Ar.IsLoading()) return true;
+
+	if (!bIsBaked)
+	{
+		Reset();
+
+		return true;
+	}
+
+	if (Version != JOINT_BAKED_GRAPH_VERSION)
+	{
+		UE_LOG(LogJoint, Warning, TEXT("FJointBakedGraph : Discarded a baked graph of an other version (%d, expected %d). The node objects will be used instead. Please recook the content."), Version, JOINT_BAKED_GRAPH_VERSION);
+
+		Reset();
+
+		return true;
+	}
+
+	FMemoryReader Reader(Payload);
+
+	SerializePayload(Reader);
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogJoint, Warning, TEXT("FJointBakedGraph : Failed to read a baked graph. The node objects will be used instead. Please recook the content."));
+
+		Reset();
+
+		return true;
+	}
+
+	RebuildGuidIndex();
+
+	return true;
+}
+
+void FJointBakedGraph::SerializePayload(FArchive& Ar)
+{
+	Ar << Nodes;
+
+	TagIndices.BulkSerialize(Ar);
+
+	//Serialize the interned tags by their names, so the tag table doesn't depend on the net index of the tags.
+	int32 TagNum = Tags.Num();
+
+	Ar << TagNum;
+
+	if (Ar.IsLoading()) Tags.SetNum(TagNum);
+
+	for (FGameplayTag& Tag : Tags)
+	{
+		FName TagName = Tag.GetTagName();
+
+		Ar << TagName;
+
+		if (Ar.IsLoading()) Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+	}
+}
+
+void FJointBakedGraph::RebuildGuidIndex()
+{
+	GuidToIndex.Empty(Nodes.Num());
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		GuidToIndex.Add(Nodes[NodeIndex].NodeGuid, NodeIndex);
+	}
+}
+
+
+#if WITH_EDITOR
+
+static TAutoConsoleVariable<int32> CVarJointBakedGraphReport(
+	TEXT("Joint.BakedGraph.Report"),
+	0,
+	TEXT("Whether to report the size & load time of the baked Joint graphs on the cook.\n")
+	TEXT("0 : Off, 1 : On"));
+
+void FJointBakedGraphCookReport::Write(UJointManager* InJointManager, const FJointBakedGraph& InBakedGraph, const ITargetPlatform* TargetPlatform, const double BakeSeconds)
+{
+	if (CVarJointBakedGraphReport.GetValueOnAnyThread() <= 0 || InJointManager == nullptr) return;
+
+	//The object graph: the manager and all the nodes under it.
+	TArray<UObject*> GraphObjects;
+
+	GraphObjects.Add(InJointManager);
+
+	GetObjectsWithOuter(InJointManager, GraphObjects, true);
+
+	int64 ObjectGraphBytes = 0;
+
+	for (UObject* GraphObject : GraphObjects)
+	{
+		FArchiveCountMem CountMem(GraphObject);
+
+		ObjectGraphBytes += CountMem.GetMax();
+	}
+
+	//The baked graph: serialized size of the payload (plus the node object references) and the time to load it back.
+	TArray<uint8> PayloadBytes;
+
+	{
+		FMemoryWriter Writer(PayloadBytes);
+
+		const_cast<FJointBakedGraph&>(InBakedGraph).SerializePayload(Writer);
+	}
+
+	const int64 BakedBytes = PayloadBytes.Num() + InBakedGraph.NodeObjects.Num() * sizeof(FPackageIndex);
+
+	const double BakedLoadStartTime = FPlatformTime::Seconds();
+
+	{
+		FJointBakedGraph LoadedGraph;
+
+		FMemoryReader Reader(PayloadBytes);
+
+		LoadedGraph.SerializePayload(Reader);
+		LoadedGraph.RebuildGuidIndex();
+	}
+
+	const double BakedLoadSeconds = FPlatformTime::Seconds() - BakedLoadStartTime;
+
+	const FString PlatformName = TargetPlatform ? TargetPlatform->PlatformName() : FString(TEXT("None"));
+
+	UE_LOG(LogJoint, Display, TEXT("Joint baked graph : %s (%s) - Nodes : %d, Objects : %d, Object graph : %lld bytes, Baked graph : %lld bytes (%llu bytes in memory), Bake : %.3f ms, Baked load : %.3f ms"),
+		*InJointManager->GetPathName(),
+		*PlatformName,
+		InBakedGraph.Num(),
+		GraphObjects.Num(),
+		ObjectGraphBytes,
+		BakedBytes,
+		static_cast<uint64>(InBakedGraph.GetAllocatedSize()),
+		BakeSeconds * 1000.0,
+		BakedLoadSeconds * 1000.0);
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("Joint") / TEXT("JointBakedGraphReport.csv");
+
+	//Start a new report with the first bake of this process, so the rows of the previous cooks don't pile up in the file.
+	static bool bHasStartedReport = false;
+
+	FString Line;
+
+	if (!bHasStartedReport)
+	{
+		Line += TEXT("Asset,Platform,Nodes,Objects,ObjectGraphBytes,BakedBytes,BakeMs,BakedLoadMs") LINE_TERMINATOR;
+	}
+
+	Line += FString::Printf(TEXT("%s,%s,%d,%d,%lld,%lld,%.4f,%.4f") LINE_TERMINATOR,
+		*InJointManager->GetPathName(),
+		*PlatformName,
+		InBakedGraph.Num(),
+		GraphObjects.Num(),
+		ObjectGraphBytes,
+		BakedBytes,
+		BakeSeconds * 1000.0,
+		BakedLoadSeconds * 1000.0);
+
+	FFileHelper::SaveStringToFile(Line, *ReportPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), bHasStartedReport ? FILEWRITE_Append : FILEWRITE_None);
+
+	bHasStartedReport = true;
+}
+
+#endif
+
+
+#undef JOINT_BAKED_GRAPH_VERSION
@@ -4,6 +4,8 @@
 #include "SharedType/JointBuildPreset.h"
 
 #include "Interfaces/ITargetPlatform.h"
+#include "Node/JointNodeBase.h"
+#include "Misc/ScopeRWLock.h"
 
 #include "Misc/EngineVersionComparison.h"
 
@@ -98,3 +100,110 @@ const bool UJointBuildPreset::AllowForBuildTarget(const ITargetPlatform* TargetP
 	return true;
 
 }
+
+
+#if WITH_EDITOR
+
+FJointBuildPresetCache& FJointBuildPresetCache::Get()
+{
+	static FJointBuildPresetCache Instance;
+
+	return Instance;
+}
+
+bool FJointBuildPresetCache::IsActive() const
+{
+	return IsRunningCookCommandlet();
+}
+
+FJointBuildPresetCache::FDecisionKey FJointBuildPresetCache::MakeKey(const UObject* Object, const FSoftObjectPath& PresetPath, const EJointBuildPresetQuery Query, const ITargetPlatform* TargetPlatform)
+{
+	FDecisionKey Key;
+
+	Key.Object = FObjectKey(Object);
+	Key.PresetPath = PresetPath;
+	Key.Query = Query;
+
+	//Only the build target decisions differ per platform.
+	Key.TargetPlatform = Query == EJointBuildPresetQuery::BuildTarget ? TargetPlatform : nullptr;
+
+	return Key;
+}
+
+bool FJointBuildPresetCache::Allows(const TSoftObjectPtr<UJointBuildPreset>& Preset, const EJointBuildPresetQuery Query, const ITargetPlatform* TargetPlatform)
+{
+	if (Preset.IsNull()) return true;
+
+	const bool bIsActive = IsActive();
+
+	const FDecisionKey Key = MakeKey(nullptr, Preset.ToSoftObjectPath(), Query, TargetPlatform);
+
+	if (bIsActive)
+	{
+		FReadScopeLock ReadLock(Lock);
+
+		if (const bool* Found = PresetDecisions.Find(Key)) return *Found;
+	}
+
+	bool bAllowed = true;
+
+	if (UJointBuildPreset* LoadedPreset = Preset.LoadSynchronous())
+	{
+		switch (Query)
+		{
+		case EJointBuildPresetQuery::Client:
+			bAllowed = LoadedPreset->AllowForClient();
+			break;
+		case EJointBuildPresetQuery::Server:
+			bAllowed = LoadedPreset->AllowForServer();
+			break;
+		case EJointBuildPresetQuery::BuildTarget:
+			bAllowed = LoadedPreset->AllowForBuildTarget(TargetPlatform);
+			break;
+		}
+	}
+
+	if (bIsActive)
+	{
+		FWriteScopeLock WriteLock(Lock);
+
+		PresetDecisions.Add(Key, bAllowed);
+	}
+
+	return bAllowed;
+}
+
+bool FJointBuildPresetCache::FindNodeDecision(const UJointNodeBase* Node, const EJointBuildPresetQuery Query, const ITargetPlatform* TargetPlatform, bool& bOutAllowed) const
+{
+	if (Node == nullptr || !IsActive()) return false;
+
+	FReadScopeLock ReadLock(Lock);
+
+	if (const bool* Found = NodeDecisions.Find(MakeKey(Node, FSoftObjectPath(), Query, TargetPlatform)))
+	{
+		bOutAllowed = *Found;
+
+		return true;
+	}
+
+	return false;
+}
+
+void FJointBuildPresetCache::StoreNodeDecision(const UJointNodeBase* Node, const EJointBuildPresetQuery Query, const ITargetPlatform* TargetPlatform, const bool bAllowed)
+{
+	if (Node == nullptr || !IsActive()) return;
+
+	FWriteScopeLock WriteLock(Lock);
+
+	NodeDecisions.Add(MakeKey(Node, FSoftObjectPath(), Query, TargetPlatform), bAllowed);
+}
+
+void FJointBuildPresetCache::Reset()
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	PresetDecisions.Empty();
+	NodeDecisions.Empty();
+}
+
+#endif
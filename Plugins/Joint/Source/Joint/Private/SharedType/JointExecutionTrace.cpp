@@ -0,0 +1,270 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "SharedType/JointExecutionTrace.h"
+
+#include "JointActor.h"
+#include "JointLogChannels.h"
+#include "Node/JointNodeBase.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#define JOINT_EXECUTION_TRACE_MAGIC 0x4A545243 // 'JTRC'
+#define JOINT_EXECUTION_TRACE_VERSION 1
+
+FArchive& operator<<(FArchive& Ar, FJointTraceRecord& Record)
+{
+	Ar << Record.Timestamp;
+	Ar << Record.NodeGuid;
+	Ar << reinterpret_cast<uint8&>(Record.Type);
+	Ar << reinterpret_cast<uint8&>(Record.ExecutionType);
+	Ar << Record.Count;
+
+	return Ar;
+}
+
+FJointExecutionTrace::FJointExecutionTrace(const int32 InCapacity)
+{
+	Records.SetNum(FMath::Max(InCapacity, 1));
+
+	StartSeconds = FPlatformTime::Seconds();
+}
+
+void FJointExecutionTrace::AddRecord(const FJointTraceRecord& Record)
+{
+	Records[Head] = Record;
+
+	Head = (Head + 1) % Records.Num();
+
+	if (NumRecords < Records.Num())
+	{
+		++NumRecords;
+	}
+	else
+	{
+		bHasWrapped = true;
+	}
+}
+
+void FJointExecutionTrace::RecordExecution(const EJointActorExecutionType ExecutionType, const UJointNodeBase* Node)
+{
+	FJointTraceRecord Record;
+	Record.Timestamp = FPlatformTime::Seconds() - StartSeconds;
+	Record.NodeGuid = Node ? Node->NodeGuid : FGuid();
+	Record.Type = EJointTraceRecordType::Execution;
+	Record.ExecutionType = ExecutionType;
+
+	AddRecord(Record);
+}
+
+void FJointExecutionTrace::RecordSelection(const UJointNodeBase* Node, TConstArrayView<UJointNodeBase*> SelectedNodes)
+{
+	FJointTraceRecord Record;
+	Record.Timestamp = FPlatformTime::Seconds() - StartSeconds;
+	Record.NodeGuid = Node ? Node->NodeGuid : FGuid();
+	Record.Type = EJointTraceRecordType::Selection;
+	Record.Count = static_cast<uint16>(FMath::Min(SelectedNodes.Num(), static_cast<int32>(MAX_uint16)));
+
+	AddRecord(Record);
+
+	Record.Type = EJointTraceRecordType::SelectedNode;
+	Record.Count = 0;
+
+	for (int32 Index = 0; Index < SelectedNodes.Num() && Index < MAX_uint16; ++Index)
+	{
+		Record.NodeGuid = SelectedNodes[Index] ? SelectedNodes[Index]->NodeGuid : FGuid();
+
+		AddRecord(Record);
+	}
+}
+
+void FJointExecutionTrace::Reset()
+{
+	Head = 0;
+	NumRecords = 0;
+	bHasWrapped = false;
+	StartSeconds = FPlatformTime::Seconds();
+}
+
+int32 FJointExecutionTrace::Num() const
+{
+	return NumRecords;
+}
+
+int32 FJointExecutionTrace::GetCapacity() const
+{
+	return Records.Num();
+}
+
+bool FJointExecutionTrace::HasWrapped() const
+{
+	return bHasWrapped;
+}
+
+void FJointExecutionTrace::GetRecords(TArray<FJointTraceRecord>& OutRecords) const
+{
+	OutRecords.Reset(NumRecords);
+
+	//The oldest record is at the head once the buffer is full.
+	const int32 Start = NumRecords < Records.Num() ? 0 : Head;
+
+	for (int32 Index = 0; Index < NumRecords; ++Index)
+	{
+		OutRecords.Add(Records[(Start + Index) % Records.Num()]);
+	}
+}
+
+bool FJointExecutionTrace::SaveToFile(const FString& FilePath) const
+{
+	TArray<FJointTraceRecord> OrderedRecords;
+	GetRecords(OrderedRecords);
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = JOINT_EXECUTION_TRACE_MAGIC;
+	uint32 Version = JOINT_EXECUTION_TRACE_VERSION;
+	FGuid SavedJointGuid = JointGuid;
+	FString SavedJointManagerPath = JointManagerPath.ToString();
+	bool bSavedHasWrapped = bHasWrapped;
+
+	Writer << Magic << Version << SavedJointGuid << SavedJointManagerPath << bSavedHasWrapped;
+	Writer << OrderedRecords;
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+
+	return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+bool FJointExecutionTrace::LoadFromFile(const FString& FilePath, FJointExecutionTrace& OutTrace)
+{
+	TArray<uint8> Bytes;
+
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath)) return false;
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+
+	Reader << Magic << Version;
+
+	if (Magic != JOINT_EXECUTION_TRACE_MAGIC || Version != JOINT_EXECUTION_TRACE_VERSION)
+	{
+		UE_LOG(LogJoint, Error, TEXT("Joint: %s is not a Joint execution trace of the current version."), *FilePath);
+
+		return false;
+	}
+
+	FString LoadedJointManagerPath;
+	TArray<FJointTraceRecord> LoadedRecords;
+
+	Reader << OutTrace.JointGuid << LoadedJointManagerPath << OutTrace.bHasWrapped;
+	Reader << LoadedRecords;
+
+	if (Reader.IsError()) return false;
+
+	OutTrace.JointManagerPath = FSoftObjectPath(LoadedJointManagerPath);
+	OutTrace.Records = MoveTemp(LoadedRecords);
+	OutTrace.NumRecords = OutTrace.Records.Num();
+	OutTrace.Head = 0;
+
+	//Keep the trace writable.
+	if (OutTrace.Records.IsEmpty()) OutTrace.Records.SetNum(1);
+
+	return true;
+}
+
+FString FJointExecutionTrace::MakeDumpFilePath(const AJointActor* InJointActor)
+{
+	const FString JointName = InJointActor ? InJointActor->JointGuid.ToString(EGuidFormats::Digits) : FString(TEXT("Joint"));
+
+	return FPaths::ProjectSavedDir() / TEXT("Joint") / TEXT("Traces") / FString::Printf(TEXT("%s_%s.jtrace"), *JointName, *FDateTime::Now().ToString());
+}
+
+
+FJointExecutionTraceReplay::FJointExecutionTraceReplay(const FJointExecutionTrace& InTrace)
+{
+	InTrace.GetRecords(Records);
+
+	SkipToNextExecution();
+
+	while (Records.IsValidIndex(SelectionCursor) && Records[SelectionCursor].Type != EJointTraceRecordType::Selection) ++SelectionCursor;
+}
+
+void FJointExecutionTraceReplay::SkipToNextExecution()
+{
+	while (Records.IsValidIndex(ExecutionCursor) && Records[ExecutionCursor].Type != EJointTraceRecordType::Execution) ++ExecutionCursor;
+}
+
+const FJointTraceRecord* FJointExecutionTraceReplay::PeekExecution() const
+{
+	return Records.IsValidIndex(ExecutionCursor) ? &Records[ExecutionCursor] : nullptr;
+}
+
+void FJointExecutionTraceReplay::SkipExecution()
+{
+	if (!Records.IsValidIndex(ExecutionCursor)) return;
+
+	++NumDivergences;
+	++ExecutionCursor;
+
+	SkipToNextExecution();
+}
+
+void FJointExecutionTraceReplay::NotifyExecuted(const EJointActorExecutionType ExecutionType, const FGuid& NodeGuid)
+{
+	const FJointTraceRecord* NextExecution = PeekExecution();
+
+	//Executions that have not been recorded are fine - the Joint can do more on its own than it did on the recording. (e.g. the requests that got rejected there)
+	if (NextExecution == nullptr || NextExecution->ExecutionType != ExecutionType || NextExecution->NodeGuid != NodeGuid) return;
+
+	++NumReplayedExecutions;
+	++ExecutionCursor;
+
+	SkipToNextExecution();
+}
+
+bool FJointExecutionTraceReplay::ConsumeSelection(const FGuid& NodeGuid, TArray<FGuid, TInlineAllocator<4>>& OutSelectedNodeGuids)
+{
+	if (!Records.IsValidIndex(SelectionCursor) || Records[SelectionCursor].NodeGuid != NodeGuid)
+	{
+		++NumDivergences;
+
+		return false;
+	}
+
+	const int32 Count = Records[SelectionCursor].Count;
+
+	for (int32 Index = SelectionCursor + 1; Index < Records.Num() && Index <= SelectionCursor + Count; ++Index)
+	{
+		if (Records[Index].Type != EJointTraceRecordType::SelectedNode) break;
+
+		OutSelectedNodeGuids.Add(Records[Index].NodeGuid);
+	}
+
+	++SelectionCursor;
+
+	while (Records.IsValidIndex(SelectionCursor) && Records[SelectionCursor].Type != EJointTraceRecordType::Selection) ++SelectionCursor;
+
+	return true;
+}
+
+bool FJointExecutionTraceReplay::IsFinished() const
+{
+	return !Records.IsValidIndex(ExecutionCursor);
+}
+
+int32 FJointExecutionTraceReplay::GetNumReplayedExecutions() const
+{
+	return NumReplayedExecutions;
+}
+
+int32 FJointExecutionTraceReplay::GetNumDivergences() const
+{
+	return NumDivergences;
+}
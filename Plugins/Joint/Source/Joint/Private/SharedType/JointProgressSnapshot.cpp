@@ -0,0 +1,18 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "SharedType/JointProgressSnapshot.h"
+
+#include "JointManager.h"
+
+bool FJointProgressSnapshot::IsValid() const
+{
+	return !Data.IsEmpty();
+}
+
+void FJointProgressSnapshot::Reset()
+{
+	JointGuid.Invalidate();
+	JointManager.Reset();
+	Data.Reset();
+}
@@ -0,0 +1,401 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "SharedType/JointReachability.h"
+
+#include "JointLogChannels.h"
+#include "JointManager.h"
+#include "Node/JointFragment.h"
+#include "Node/JointNodeBase.h"
+#include "SharedType/JointSharedTypes.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UnrealType.h"
+
+//Bump it whenever the layout of the payload changes. The tables of the other versions will be discarded on the load and analyzed again on the next compile.
+//The fields that are serialized before the payload (the version, bIsValid, the node objects and the payload size) must stay the same across the versions.
+#define JOINT_REACHABILITY_VERSION 2
+
+
+namespace JointReachability
+{
+	enum ENodeFlag : uint8
+	{
+		Reachable = 1 << 0,
+		Referenced = 1 << 1,
+	};
+
+	void AddPointedNode(const FJointNodePointer* Pointer, TArray<UJointNodeBase*>& OutNodes)
+	{
+		if (Pointer == nullptr) return;
+
+		UJointNodeBase* PointedNode = Pointer->Node.Get();
+
+		if (PointedNode == nullptr) return;
+
+		if (UJointNodeBase* PointedBaseNode = PointedNode->GetParentmostNode()) OutNodes.AddUnique(PointedBaseNode);
+	}
+
+	//Collect the base nodes the FJointNodePointer properties of the provided node point to.
+	void CollectPointedNodes(UJointNodeBase* Node, TArray<UJointNodeBase*>& OutNodes)
+	{
+		if (Node == nullptr) return;
+
+		const UScriptStruct* PointerStruct = FJointNodePointer::StaticStruct();
+
+		for (TFieldIterator<FProperty> It(Node->GetClass()); It; ++It)
+		{
+			const FProperty* Property = *It;
+
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (StructProperty->Struct != PointerStruct) continue;
+
+				for (int32 Index = 0; Index < StructProperty->ArrayDim; ++Index)
+				{
+					AddPointedNode(StructProperty->ContainerPtrToValuePtr<FJointNodePointer>(Node, Index), OutNodes);
+				}
+			}
+			else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				const FStructProperty* InnerProperty = CastField<FStructProperty>(ArrayProperty->Inner);
+
+				if (InnerProperty == nullptr || InnerProperty->Struct != PointerStruct) continue;
+
+				FScriptArrayHelper_InContainer ArrayHelper(ArrayProperty, Node);
+
+				for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+				{
+					AddPointedNode(reinterpret_cast<const FJointNodePointer*>(ArrayHelper.GetRawPtr(Index)), OutNodes);
+				}
+			}
+		}
+	}
+
+	void CollectPointedNodesOnHierarchy(UJointNodeBase* Node, TArray<UJointNodeBase*>& OutNodes)
+	{
+		if (Node == nullptr) return;
+
+		CollectPointedNodes(Node, OutNodes);
+
+		for (UJointFragment* Fragment : Node->GetAllFragmentsOnLowerHierarchy())
+		{
+			CollectPointedNodes(Fragment, OutNodes);
+		}
+	}
+}
+
+
+FJointReachability FJointReachability::Analyze(UJointManager* InJointManager)
+{
+	FJointReachability Result;
+
+	if (InJointManager == nullptr) return Result;
+
+	for (UJointNodeBase* Node : InJointManager->Nodes)
+	{
+		//Only the base nodes are on the table. Their fragments share the state of them.
+		if (Node == nullptr || Node->GetParentNode() != nullptr) continue;
+
+		Result.NodeObjects.Add(Node);
+		Result.NodeGuids.Add(Node->GetNodeGuid());
+	}
+
+	Result.RebuildGuidIndex();
+
+	const int32 NodeNum = Result.NodeGuids.Num();
+
+	//Build the successor table.
+	TArray<UJointNodeBase*> PossibleNextNodes;
+
+	Result.SuccessorOffsets.Reserve(NodeNum + 1);
+
+	for (int32 NodeIndex = 0; NodeIndex < NodeNum; ++NodeIndex)
+	{
+		Result.SuccessorOffsets.Add(Result.Successors.Num());
+
+		PossibleNextNodes.Reset();
+
+		//Read the node properties directly - the possible next nodes of the node would be answered from this table otherwise.
+		Result.NodeObjects[NodeIndex]->CollectPossibleNextNodesFromProperties(PossibleNextNodes);
+
+		for (const UJointNodeBase* PossibleNextNode : PossibleNextNodes)
+		{
+			const int32 NextNodeIndex = PossibleNextNode ? Result.FindNodeIndex(PossibleNextNode->GetNodeGuid()) : INDEX_NONE;
+
+			if (NextNodeIndex != INDEX_NONE) Result.Successors.Add(NextNodeIndex);
+		}
+	}
+
+	Result.SuccessorOffsets.Add(Result.Successors.Num());
+
+	for (const UJointNodeBase* StartNode : InJointManager->StartNodes)
+	{
+		const int32 StartNodeIndex = StartNode ? Result.FindNodeIndex(StartNode->GetNodeGuid()) : INDEX_NONE;
+
+		if (StartNodeIndex != INDEX_NONE) Result.StartNodeIndices.AddUnique(StartNodeIndex);
+	}
+
+	Result.NodeFlags.SetNumZeroed(NodeNum);
+
+	TArray<int32> Queue;
+
+	Queue.Reserve(NodeNum);
+
+	//Pass 1 : The nodes that can be reached from the start nodes.
+	for (const int32 StartNodeIndex : Result.StartNodeIndices)
+	{
+		Result.NodeFlags[StartNodeIndex] |= JointReachability::Reachable;
+
+		Queue.Add(StartNodeIndex);
+	}
+
+	for (int32 Cursor = 0; Cursor < Queue.Num(); ++Cursor)
+	{
+		for (const int32 SuccessorIndex : Result.GetSuccessorIndices(Queue[Cursor]))
+		{
+			if (Result.NodeFlags[SuccessorIndex] & JointReachability::Reachable) continue;
+
+			Result.NodeFlags[SuccessorIndex] |= JointReachability::Reachable;
+
+			Queue.Add(SuccessorIndex);
+		}
+	}
+
+	//Pass 2 : The nodes that are pointed by the live nodes & the manager fragments. A referenced node can be moved to by the nodes that play it by themselves, so follow its successors as well.
+	TArray<UJointNodeBase*> PointedNodes;
+
+	auto MarkReferenced = [&Result, &Queue](const UJointNodeBase* PointedNode)
+	{
+		const int32 PointedNodeIndex = PointedNode ? Result.FindNodeIndex(PointedNode->GetNodeGuid()) : INDEX_NONE;
+
+		if (PointedNodeIndex == INDEX_NONE || Result.NodeFlags[PointedNodeIndex] != 0) return;
+
+		Result.NodeFlags[PointedNodeIndex] |= JointReachability::Referenced;
+
+		Queue.Add(PointedNodeIndex);
+	};
+
+	for (UJointNodeBase* ManagerFragment : InJointManager->ManagerFragments)
+	{
+		JointReachability::CollectPointedNodesOnHierarchy(ManagerFragment, PointedNodes);
+	}
+
+	for (const UJointNodeBase* PointedNode : PointedNodes) MarkReferenced(PointedNode);
+
+	for (int32 Cursor = 0; Cursor < Queue.Num(); ++Cursor)
+	{
+		const int32 NodeIndex = Queue[Cursor];
+
+		PointedNodes.Reset();
+
+		JointReachability::CollectPointedNodesOnHierarchy(Result.NodeObjects[NodeIndex], PointedNodes);
+
+		for (const UJointNodeBase* PointedNode : PointedNodes) MarkReferenced(PointedNode);
+
+		for (const int32 SuccessorIndex : Result.GetSuccessorIndices(NodeIndex)) MarkReferenced(Result.NodeObjects[SuccessorIndex]);
+	}
+
+	Result.bIsValid = true;
+
+	return Result;
+}
+
+bool FJointReachability::IsValid() const
+{
+	return bIsValid;
+}
+
+void FJointReachability::Reset()
+{
+	NodeObjects.Empty();
+	NodeGuids.Empty();
+	SuccessorOffsets.Empty();
+	Successors.Empty();
+	StartNodeIndices.Empty();
+	NodeFlags.Empty();
+	GuidToIndex.Empty();
+
+	bIsValid = false;
+}
+
+int32 FJointReachability::Num() const
+{
+	return NodeGuids.Num();
+}
+
+int32 FJointReachability::FindNodeIndex(const FGuid& NodeGuid) const
+{
+	const int32* Found = GuidToIndex.Find(NodeGuid);
+
+	return Found ? *Found : INDEX_NONE;
+}
+
+const FGuid& FJointReachability::GetNodeGuid(const int32 NodeIndex) const
+{
+	return NodeGuids[NodeIndex];
+}
+
+UJointNodeBase* FJointReachability::GetNodeObject(const int32 NodeIndex) const
+{
+	return NodeObjects.IsValidIndex(NodeIndex) ? NodeObjects[NodeIndex].Get() : nullptr;
+}
+
+TConstArrayView<int32> FJointReachability::GetSuccessorIndices(const int32 NodeIndex) const
+{
+	if (!NodeGuids.IsValidIndex(NodeIndex) || !SuccessorOffsets.IsValidIndex(NodeIndex + 1)) return TConstArrayView<int32>();
+
+	const int32 Start = SuccessorOffsets[NodeIndex];
+
+	return TConstArrayView<int32>(Successors.GetData() + Start, SuccessorOffsets[NodeIndex + 1] - Start);
+}
+
+TConstArrayView<int32> FJointReachability::GetStartNodeIndices() const
+{
+	return StartNodeIndices;
+}
+
+bool FJointReachability::HasFlag(const int32 NodeIndex, const uint8 Flag) const
+{
+	return NodeFlags.IsValidIndex(NodeIndex) && (NodeFlags[NodeIndex] & Flag) != 0;
+}
+
+bool FJointReachability::IsReachableFromStart(const int32 NodeIndex) const
+{
+	return HasFlag(NodeIndex, JointReachability::Reachable);
+}
+
+bool FJointReachability::IsNodeLive(const int32 NodeIndex) const
+{
+	return HasFlag(NodeIndex, JointReachability::Reachable | JointReachability::Referenced);
+}
+
+bool FJointReachability::CanReach(const FGuid& FromNodeGuid, const FGuid& ToNodeGuid) const
+{
+	const int32 FromIndex = FindNodeIndex(FromNodeGuid);
+	const int32 ToIndex = FindNodeIndex(ToNodeGuid);
+
+	if (FromIndex == INDEX_NONE || ToIndex == INDEX_NONE) return false;
+
+	if (FromIndex == ToIndex) return true;
+
+	TBitArray<TInlineAllocator<4>> Visited(false, Num());
+	TArray<int32, TInlineAllocator<64>> Queue;
+
+	Visited[FromIndex] = true;
+	Queue.Add(FromIndex);
+
+	for (int32 Cursor = 0; Cursor < Queue.Num(); ++Cursor)
+	{
+		for (const int32 SuccessorIndex : GetSuccessorIndices(Queue[Cursor]))
+		{
+			if (SuccessorIndex == ToIndex) return true;
+
+			if (Visited[SuccessorIndex]) continue;
+
+			Visited[SuccessorIndex] = true;
+			Queue.Add(SuccessorIndex);
+		}
+	}
+
+	return false;
+}
+
+void FJointReachability::GetUnreachableNodeGuids(TArray<FGuid>& OutNodeGuids) const
+{
+	for (int32 NodeIndex = 0; NodeIndex < NodeGuids.Num(); ++NodeIndex)
+	{
+		if (!IsNodeLive(NodeIndex)) OutNodeGuids.Add(NodeGuids[NodeIndex]);
+	}
+}
+
+SIZE_T FJointReachability::GetAllocatedSize() const
+{
+	return NodeObjects.GetAllocatedSize()
+		+ NodeGuids.GetAllocatedSize()
+		+ SuccessorOffsets.GetAllocatedSize()
+		+ Successors.GetAllocatedSize()
+		+ StartNodeIndices.GetAllocatedSize()
+		+ NodeFlags.GetAllocatedSize()
+		+ GuidToIndex.GetAllocatedSize();
+}
+
+bool FJointReachability::Serialize(FArchive& Ar)
+{
+	int32 Version = JOINT_REACHABILITY_VERSION;
+
+	Ar << Version;
+	Ar << bIsValid;
+
+	//The object references stay on the archive itself, so they will be resolved (and remapped on the duplication) as usual.
+	Ar << NodeObjects;
+
+	//The rest of the table goes in one blob, so a blob of the other versions can be skipped without knowing its layout.
+	TArray<uint8> Payload;
+
+	if (Ar.IsSaving() && bIsValid)
+	{
+		FMemoryWriter Writer(Payload);
+
+		SerializePayload(Writer);
+	}
+
+	Payload.BulkSerialize(Ar);
+
+	if (!Ar.IsLoading()) return true;
+
+	if (!bIsValid)
+	{
+		Reset();
+
+		return true;
+	}
+
+	if (Version != JOINT_REACHABILITY_VERSION)
+	{
+		UE_LOG(LogJoint, Log, TEXT("FJointReachability : Discarded a reachability table of an other version (%d, expected %d). It will be analyzed again on the next compile or save."), Version, JOINT_REACHABILITY_VERSION);
+
+		Reset();
+
+		return true;
+	}
+
+	FMemoryReader Reader(Payload);
+
+	SerializePayload(Reader);
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogJoint, Warning, TEXT("FJointReachability : Failed to read a reachability table. It will be analyzed again on the next compile or save."));
+
+		Reset();
+
+		return true;
+	}
+
+	RebuildGuidIndex();
+
+	return true;
+}
+
+void FJointReachability::SerializePayload(FArchive& Ar)
+{
+	NodeGuids.BulkSerialize(Ar);
+	SuccessorOffsets.BulkSerialize(Ar);
+	Successors.BulkSerialize(Ar);
+	StartNodeIndices.BulkSerialize(Ar);
+	NodeFlags.BulkSerialize(Ar);
+}
+
+void FJointReachability::RebuildGuidIndex()
+{
+	GuidToIndex.Empty(NodeGuids.Num());
+
+	for (int32 NodeIndex = 0; NodeIndex < NodeGuids.Num(); ++NodeIndex)
+	{
+		GuidToIndex.Add(NodeGuids[NodeIndex], NodeIndex);
+	}
+}
+
+
+#undef JOINT_REACHABILITY_VERSION
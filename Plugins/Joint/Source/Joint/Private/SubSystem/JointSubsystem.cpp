@@ -31,6 +31,29 @@ AJointActor* UJointSubsystem::CreateJoint(
 	return nullptr;
 }
 
+AJointActor* UJointSubsystem::CreateJointFromSnapshot(
+	UObject* WorldContextObject,
+	const FJointProgressSnapshot& Snapshot,
+	TSubclassOf<AJointActor> OptionalJointInstanceSubclass)
+{
+	if (!Snapshot.IsValid()) return nullptr;
+
+	UJointManager* JointAssetToPlay = Snapshot.JointManager.LoadSynchronous();
+
+	AJointActor* JointActor = CreateJoint(WorldContextObject, JointAssetToPlay, OptionalJointInstanceSubclass);
+
+	if (JointActor == nullptr) return nullptr;
+
+	if (!JointActor->RestoreProgressSnapshot(Snapshot))
+	{
+		JointActor->Destroy();
+
+		return nullptr;
+	}
+
+	return JointActor;
+}
+
 AJointActor* UJointSubsystem::FindJoint(UObject* WorldContextObject, FGuid JointGuid)
 {
 	if (WorldContextObject != nullptr && WorldContextObject->GetWorld())
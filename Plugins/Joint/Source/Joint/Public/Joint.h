@@ -6,6 +6,8 @@
 #include "Subsystem/JointSubsystem.h"
 #include "Modules/ModuleManager.h"
 
+class UJointManager;
+
 class FJointModule : public IModuleInterface
 {
 public:
@@ -22,6 +24,8 @@ public:
 	DECLARE_DELEGATE_TwoParams(FJointDebuggerNodePlaybackNotification, AJointActor*, UJointNodeBase*);
 
 	DECLARE_DELEGATE_TwoParams(FJointDebuggerJointPlaybackNotification, AJointActor*, const FGuid&);
+
+	DECLARE_DELEGATE_TwoParams(FGatherJointEditorAssetRegistryTags, const UJointManager*, TArray<UObject::FAssetRegistryTag>&);
 	
 	FCheckJointExecutionException OnJointExecutionExceptionDelegate;
 
@@ -35,6 +39,12 @@ public:
 
 	FJointDebuggerJointPlaybackNotification JointDebuggerJointEndPlayNotification;
 
+	/**
+	 * Add the asset registry tags of the editor data (e.g. the editor nodes) of the Joint manager. See FJointAssetRegistryTags.
+	 * Joint 2.12.0 : Added.
+	 */
+	FGatherJointEditorAssetRegistryTags OnGatherEditorAssetRegistryTags;
+
 #endif
 	
 };
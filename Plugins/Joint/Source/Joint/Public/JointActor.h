@@ -6,6 +6,7 @@
 #include "AbilitySystemComponent.h"
 #include "GameFramework/Actor.h"
 #include "SharedType/JointSharedTypes.h"
+#include "SharedType/JointProgressSnapshot.h"
 #include "JointActor.generated.h"
 
 
@@ -40,9 +41,16 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJointEnded, AJointActor*, JointIn
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FJointNodePlaybackEvent, AJointActor*, JointInstance,
                                              UJointNodeBase*, Node);
 
+DECLARE_MULTICAST_DELEGATE_TwoParams(FJointNodePlaybackEventNative, AJointActor* /*JointInstance*/, UJointNodeBase* /*Node*/);
+
+DECLARE_DELEGATE_RetVal_TwoParams(bool, FJointNextNodeSelectionOverride, UJointNodeBase* /*PlayingNode*/, FJointNodeSelection& /*OutNodes*/);
+
 
 class UJointSubsystem;
 class UJointNodeBase;
+struct FStreamableHandle;
+class FJointExecutionTrace;
+class FJointExecutionTraceReplay;
 
 
 UCLASS()
@@ -168,7 +176,177 @@ public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
-	
+
+	/**
+	 * Whether to load the soft referenced assets of the nodes that can be reached from the playing node ahead, so the nodes will not have to wait for (or hitch on) the loading when they get played.
+	 * See UJointNodeBase::CollectAssetsToPrefetch() to control which assets a node provides.
+	 *
+	 * Joint 2.12.0 : Added.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Joint|Prefetch")
+	bool bPrefetchAssets = false;
+
+	/**
+	 * How many steps to look ahead from the playing node on the asset prefetching. The nearer nodes will be loaded with the higher priority.
+	 * 0 will only keep the assets of the playing node loaded.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Joint|Prefetch", meta = (ClampMin = 0, UIMin = 0, UIMax = 5))
+	int32 AssetPrefetchDepth = 2;
+
+public:
+
+	/**
+	 * Update the asset prefetching from the playing node: Start loading the assets of the newly reachable nodes, and release the assets of the nodes that are not reachable anymore.
+	 * It is called whenever a base node begins play, so you don't need to call it by yourself unless you changed the graph at runtime.
+	 * Calling it by yourself drops the cached look-ahead, so the changes on the graph will be taken into account.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Prefetch")
+	void UpdateAssetPrefetch();
+
+	/**
+	 * Release all the asset prefetch handles this instance has. The assets will be freed on the next garbage collection if nothing else refers them.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Prefetch")
+	void ReleaseAllAssetPrefetches();
+
+private:
+
+	/**
+	 * Update the asset prefetching with the cached look-ahead. Does nothing if the playing node and the depth are the same as the last update.
+	 */
+	void RefreshAssetPrefetch();
+
+	/**
+	 * Get the possible next nodes of the node from the look-ahead cache, collecting them on the first query.
+	 */
+	const TArray<TWeakObjectPtr<UJointNodeBase>>& GetCachedPossibleNextNodes(UJointNodeBase* Node);
+
+private:
+
+	/**
+	 * The streamable handles for the prefetched assets, per base node. A node without any asset to prefetch is kept with an invalid handle to avoid collecting it again.
+	 */
+	TMap<TWeakObjectPtr<UJointNodeBase>, TSharedPtr<FStreamableHandle>> AssetPrefetchHandles;
+
+	/**
+	 * The possible next nodes of the nodes that have been walked through on the asset prefetching.
+	 * The edges of a graph don't change while it is played, so each node is asked only once instead of on every base node.
+	 */
+	TMap<TWeakObjectPtr<UJointNodeBase>, TArray<TWeakObjectPtr<UJointNodeBase>>> AssetPrefetchNextNodeCache;
+
+	/**
+	 * The playing node and the depth of the last asset prefetching update.
+	 */
+	TWeakObjectPtr<UJointNodeBase> AssetPrefetchRootNode;
+
+	int32 AssetPrefetchRootDepth = INDEX_NONE;
+
+public:
+
+	/**
+	 * Capture the progress of this Joint instance into a compact binary snapshot that can be stored in a save game or handed to another server.
+	 * It holds the lifecycle states and the SaveGame properties of the nodes, keyed by their node Guids. See FJointProgressSnapshot.
+	 * Pass the same snapshot again to reuse its buffer when capturing many instances repeatedly.
+	 * @param OutSnapshot The snapshot to write to.
+	 * @return Whether the capture has succeeded. Fails if there is no Joint manager.
+	 *
+	 * Joint 2.12.0 : Added.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Snapshot")
+	bool CaptureProgressSnapshot(UPARAM(ref) FJointProgressSnapshot& OutSnapshot);
+
+	/**
+	 * Restore the progress of the snapshot into this Joint instance.
+	 * The instance must have its Joint manager set and must not have been started yet - for example, right after UJointSubsystem::CreateJoint().
+	 *
+	 * The node states are applied as they are without replaying any transition, so none of the node lifecycle events and Joint start events will be broadcast.
+	 * Instead, every restored node gets UJointNodeBase::PostNodeProgressRestored() to re-establish its runtime bindings.
+	 * The nodes that can not be found on the Joint manager (removed after the capture) are skipped.
+	 * @param Snapshot The snapshot to restore.
+	 * @return Whether the restoration has succeeded.
+	 *
+	 * Joint 2.12.0 : Added.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Snapshot")
+	bool RestoreProgressSnapshot(const FJointProgressSnapshot& Snapshot);
+
+private:
+
+	/**
+	 * The Joint manager asset the current Joint manager has been duplicated from. Stored on the snapshots to recreate the instance.
+	 */
+	UPROPERTY(Transient)
+	TSoftObjectPtr<UJointManager> SourceJointManager;
+
+public:
+
+	/**
+	 * Start recording the execution trace of this Joint instance: the node executions popped from the execution queue and the next node selections of the base nodes.
+	 * The latest records are kept in a ring buffer of the provided capacity. See FJointExecutionTrace.
+	 * Every Joint instance starts recording on StartJoint() by itself when Joint.Trace.Enable is 1.
+	 *
+	 * Joint 2.12.0 : Added.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Trace")
+	void StartExecutionTrace(const int32 Capacity = 4096);
+
+	/**
+	 * Stop recording the execution trace and discard the records.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Trace")
+	void StopExecutionTrace();
+
+	UFUNCTION(BlueprintPure, Category = "Joint|Trace")
+	bool IsRecordingExecutionTrace() const;
+
+	/**
+	 * Write the recorded execution trace to disk.
+	 * @param FilePath The file to write. If empty, a new file in Saved/Joint/Traces will be used.
+	 * @return The path of the written file. Empty if there was nothing to write or the writing has failed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint|Trace")
+	FString DumpExecutionTrace(const FString& FilePath = TEXT(""));
+
+	/**
+	 * Get the execution trace this instance is recording. nullptr if not recording.
+	 */
+	const FJointExecutionTrace* GetExecutionTrace() const;
+
+	/**
+	 * Start this Joint instance and drive it through the recorded trace right away, without waiting for any input.
+	 * The next node selections are taken from the trace, and the recorded end play & pending requests are issued by force when the Joint does not reach them by itself.
+	 * The instance must have its Joint manager set and must not have been started yet. Useful for reproducing the reported paths and the performance issues.
+	 * @param Trace The trace to replay. It must have been recorded from the start of the Joint. (Not wrapped)
+	 * @param MaxSteps The maximum number of the forced requests before giving up.
+	 * @return Whether the whole trace has been replayed without any divergence.
+	 */
+	bool ReplayExecutionTrace(const FJointExecutionTrace& Trace, const int32 MaxSteps = 100000);
+
+public:
+
+	/**
+	 * A native hook to take over the next node selection of the playing base node, for the tools that drive the Joint by themselves (e.g. the traversal benchmark).
+	 * Return true with the nodes appended to OutNodes to use them instead of the node's own selection, or false to let the node select.
+	 *
+	 * Joint 2.12.0 : Added.
+	 */
+	FJointNextNodeSelectionOverride NextNodeSelectionOverride;
+
+private:
+
+	/**
+	 * Fill the next node selection of the playing node from the replaying trace, if any.
+	 */
+	bool SelectNextNodesFromReplay(FJointNodeSelection& OutNodes);
+
+private:
+
+	TSharedPtr<FJointExecutionTrace> ExecutionTrace;
+
+	TSharedPtr<FJointExecutionTraceReplay> ExecutionTraceReplay;
+
+public:
+
 	/**
 	 * Get the node this Joint instance is currently playing.
 	 * The reference to the PlayingJointNode itself will be replicated so it will not point different object from the server,
@@ -178,6 +356,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Joint")
 	class UJointNodeBase* GetPlayingJointNode();
 
+	/**
+	 * Whether this Joint instance can still reach the provided base node from the node it is currently playing.
+	 * It uses the reachability analysis of the Joint manager (see UJointManager::CanReachNode), so it doesn't walk the nodes.
+	 * Joint 2.12.0 : Added.
+	 * @param NodeGuid The Guid of the base node to reach.
+	 * @return Whether the node can be reached. False if the Joint is not playing any node.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Joint")
+	bool CanStillReachNode(FGuid NodeGuid);
+
 protected:
 	
 	/**
@@ -274,6 +462,12 @@ private:
 	UFUNCTION()
 	UJointNodeBase* PickUpNewNodeFrom(const TArray<UJointNodeBase*>& TestTargetNodes);
 
+	/**
+	 * PickUpNewNodeFrom() for the selections of UJointNodeBase::SelectNextNodesInto().
+	 * Joint 2.12.0 : Added.
+	 */
+	UJointNodeBase* PickUpNewNodeFrom(const FJointNodeSelection& TestTargetNodes);
+
 public:
 	UFUNCTION(BlueprintPure, Category="Joint Playback")
 	bool IsJointStarted();
@@ -473,5 +667,17 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category = "Joint", DisplayName="On Joint Node Pre Marked As Pending")
 	FJointNodePlaybackEvent OnJointNodeMarkedAsPendingDelegate;
+
+public:
+
+	/**
+	 * Native (non-dynamic) versions of the node playback delegates above. They are broadcast right before the dynamic ones. Prefer these on C++.
+	 * Joint 2.12.0 : Added.
+	 */
+	FJointNodePlaybackEventNative OnJointNodeBeginPlayNative;
+
+	FJointNodePlaybackEventNative OnJointNodeEndPlayNative;
+
+	FJointNodePlaybackEventNative OnJointNodeMarkedAsPendingNative;
 	
 };
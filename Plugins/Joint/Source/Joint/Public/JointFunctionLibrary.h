@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "SharedType/JointSharedTypes.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Styling/SlateTypes.h"
 #include "JointFunctionLibrary.generated.h"
 
 class UJointManager;
@@ -12,6 +13,32 @@ class UMovieSceneJointTrack;
 class UMovieSceneSequence;
 class UMovieSceneTrack;
 class UWidget;
+
+/**
+ * The ranges of a rich text, produced by a single pass of the rich text markup parser.
+ * Joint 2.12.0 : Introduced to share one parse between the range queries, and to let the callers parse a string off the game thread.
+ */
+struct JOINT_API FJointRichTextParseResult
+{
+public:
+
+	/**
+	 * Every range that the content texts take place, including empty run's content. (Same as UJointFunctionLibrary::GetTextContentRange())
+	 */
+	TArray<FInt32Range> TextContentRange;
+
+	/**
+	 * Every range that the decorated run's content texts take places. This excludes the empty run's content. (Same as UJointFunctionLibrary::GetDecoratedTextContentRange())
+	 */
+	TArray<FInt32Range> DecoratedTextContentRange;
+
+	/**
+	 * Every range that the decorator symbols take place. (Same as UJointFunctionLibrary::GetDecoratorSymbolRange())
+	 */
+	TArray<FInt32Range> DecoratorSymbolRange;
+	
+};
+
 /**
  * 
  */
@@ -55,6 +82,7 @@ public:
 	
 	/**
 	 * Get every range that the content texts take place, including empty run's content.
+	 * Joint 2.12.0 : The parse results are cached, so it's fine to query it every tick. See GetCachedRichTextParseResult().
 	 */
 	UFUNCTION(BlueprintCallable, Category="Joint Text Utilities")
 	static TArray<FInt32Range> GetTextContentRange(FText InText);
@@ -70,18 +98,80 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category="Joint Text Utilities")
 	static TArray<FInt32Range> GetDecoratedTextContentRange(FText InText);
+
+	/**
+	 * Parse the provided rich text string once and fill out all the ranges of it.
+	 * This doesn't touch any UObject, so it can be called from any thread.
+	 * @param SourceString The string to parse. (Usually the display string of the text)
+	 * @param OutResult The ranges of the string.
+	 */
+	static void ParseRichTextRanges(const FString& SourceString, FJointRichTextParseResult& OutResult);
+
+	/**
+	 * Get the parse result of the provided rich text string from the parse cache, parsing it only if it is not cached yet.
+	 * The cache is a bounded LRU cache keyed by the source string (hashed) and the current culture, shared by GetTextContentRange(), GetDecoratorSymbolRange() and GetDecoratedTextContentRange().
+	 * The returned result is shared and must not be modified. It stays valid even after it gets evicted from the cache. Thread-safe.
+	 * @param SourceString The string to parse. (Usually the display string of the text)
+	 * @return The cached parse result.
+	 */
+	static TSharedRef<const FJointRichTextParseResult, ESPMode::ThreadSafe> GetCachedRichTextParseResult(const FString& SourceString);
+
+	/**
+	 * Get the statistics of the rich text parse cache.
+	 * @param OutHits The number of the queries that were served from the cache.
+	 * @param OutMisses The number of the queries that had to parse the text.
+	 * @param OutNum The number of the cached parse results.
+	 * @param OutCapacity The maximum number of the cached parse results.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Joint Text Utilities")
+	static void GetRichTextParseCacheStats(int64& OutHits, int64& OutMisses, int32& OutNum, int32& OutCapacity);
+
+	/**
+	 * Empty the rich text parse cache and reset its statistics.
+	 * @param NewCapacity The new maximum number of the cached parse results. Keeps the current capacity if zero or less.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Joint Text Utilities")
+	static void ResetRichTextParseCache(int32 NewCapacity = 0);
 	
 	/**
 	 * Merge text style data tables. If there is redundant row name, it will use the first case.
 	 * It only works with the table with FRichTextStyleRow row struct. if you use some custom type of it then You must try to make one custom version of this function for your project.
 	 * Note: We Highly recommended to set the row name with specific label on them.
 	 * for example, RichText.Cute.Default, RichText.Cute.Row1, RichText.Cute.Row2, RichText.Cute.Row3... like this.
+	 * Joint 2.12.0 : The merged tables are cached by the set of the source tables (in order), and rebuilt only when one of the source tables has been changed or reimported.
+	 * The merged sets whose source tables have been garbage collected are dropped after the garbage collection.
+	 * The same set of the tables will return the same merged table instance, so don't modify the returned table.
 	 * @param TablesToMerge tables to merge together.
 	 * @return A merged table instance. Notice this instance will be transient, can not be stored and serialized.
 	 */
 	UFUNCTION(BlueprintCallable, Category="Joint Text Utilities")
 	static UDataTable* MergeTextStyleDataTables(TSet<UDataTable*> TablesToMerge);
 
+	/**
+	 * Get the text style of the provided row name from the merged text style tables, without searching the tables.
+	 * The row name to style lookup table is built once per merged set. See MergeTextStyleDataTables() for the merge rules.
+	 * @param TablesToMerge tables to merge together.
+	 * @param RowName The row name of the style.
+	 * @param OutTextStyle The found text style.
+	 * @return Whether the style has been found.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Joint Text Utilities")
+	static bool FindMergedTextStyle(const TSet<UDataTable*>& TablesToMerge, const FName RowName, FTextBlockStyle& OutTextStyle);
+
+	/**
+	 * Get the row name to text style lookup table of the merged text style tables. Built once per merged set.
+	 * The returned table is shared and must not be modified. It stays valid even after the merged set gets rebuilt.
+	 * @param TablesToMerge tables to merge together.
+	 * @return Row name to the text style.
+	 */
+	static TSharedRef<const TMap<FName, FTextBlockStyle>> GetMergedTextStyleLookup(const TSet<UDataTable*>& TablesToMerge);
+
+	/**
+	 * Release all the cached merged text style tables.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Joint Text Utilities")
+	static void ClearMergedTextStyleTableCache();
+
 public:
 
 	//Pin Related
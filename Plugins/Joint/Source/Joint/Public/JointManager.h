@@ -3,12 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Misc/EngineVersionComparison.h"
 #include "UObject/Object.h"
 #include "GameplayTagContainer.h"
 #include "Net/DataBunch.h"
 #include "Templates/SubclassOf.h"
 #include "Engine/EngineTypes.h"
 #include "Engine/Blueprint.h"
+#include "SharedType/JointBakedGraph.h"
+#include "SharedType/JointReachability.h"
 #include "JointManager.generated.h"
 
 //An asset class for storaging data and some functions.
@@ -49,6 +52,98 @@ public:
 	UPROPERTY(VisibleAnywhere, Category = "Data")
 	TArray<TObjectPtr<UJointNodeBase>> ManagerFragments;
 
+public:
+
+	/**
+	 * Whether this Joint manager has a baked graph that can be used at runtime.
+	 * The graph is baked on the cook. In the editor, only the instances that are hosted by a Joint actor can have one, since the assets can be changed after the bake.
+	 * See BakeGraphForPlayInEditor() to test the baked graph on PIE.
+	 */
+	bool HasBakedGraph() const;
+
+	/**
+	 * Get the baked graph of this Joint manager. Check HasBakedGraph() before using it.
+	 */
+	const FJointBakedGraph& GetBakedGraph() const;
+
+#if WITH_EDITOR
+
+	/**
+	 * Bake the graph of this instance for the play in the editor, if Joint.BakedGraph.BakeOnPlayInEditor is set.
+	 * Called by AJointActor on its own copy of the Joint manager, so the PIE sessions can run through the same baked graph paths as the cooked builds.
+	 */
+	void BakeGraphForPlayInEditor();
+
+#endif
+
+private:
+
+	/**
+	 * The baked look-up tables of the node hierarchy. See FJointBakedGraph.
+	 * Joint 2.12.0 : Added.
+	 */
+	UPROPERTY()
+	FJointBakedGraph BakedGraph;
+
+public:
+
+	/**
+	 * Whether this Joint manager has the result of the reachability analysis that can be used at runtime.
+	 * Ignored in the editor (except for the editor features themselves) since the nodes can be changed after the analysis, unless the graph has been baked for the PIE. See BakeGraphForPlayInEditor().
+	 */
+	bool HasReachability() const;
+
+	/**
+	 * Get the result of the reachability analysis of this Joint manager. See FJointReachability.
+	 */
+	const FJointReachability& GetReachability() const;
+
+	/**
+	 * Whether the Joint can move from a base node to the other base node by following the possible next nodes.
+	 * It uses the successor table of the reachability analysis, so it is cheap enough to be used in the gameplay code. (e.g. "can this Joint still reach the ending node?")
+	 * Always false if the asset has not been analyzed yet.
+	 * @param FromNodeGuid The Guid of the base node to start from.
+	 * @param ToNodeGuid The Guid of the base node to reach.
+	 * @return Whether the node can be reached.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Joint")
+	bool CanReachNode(FGuid FromNodeGuid, FGuid ToNodeGuid) const;
+
+#if WITH_EDITOR
+
+	/**
+	 * Analyze the graph again and store the result. Called on the compile & save of the Joint manager.
+	 */
+	void UpdateReachability();
+
+	/**
+	 * Whether the provided base node should be excluded from the cooked data since it can never be reached. See bStripUnreachableNodesOnCook.
+	 */
+	bool ShouldStripNodeOnCook(const UJointNodeBase* Node) const;
+
+#endif
+
+#if WITH_EDITORONLY_DATA
+
+	/**
+	 * If true, the base nodes that can not be reached from the start nodes (and are not referenced by any node pointer of the live nodes either) will be excluded from the cooked data.
+	 * Leave it off if you play the nodes of this Joint manager by yourself, without connecting them to the graph.
+	 * Joint 2.12.0 : Added.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Cook")
+	bool bStripUnreachableNodesOnCook = false;
+
+#endif
+
+private:
+
+	/**
+	 * The successor table & the reachable nodes of the graph. See FJointReachability.
+	 * Joint 2.12.0 : Added.
+	 */
+	UPROPERTY()
+	FJointReachability Reachability;
+
 public:
 	
 	/**
@@ -294,6 +389,8 @@ public:
 
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
 
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
 #endif
 
 public:
@@ -313,5 +410,15 @@ public:
 public:
 
 	virtual void Serialize(FArchive& Ar) override;
+
+	/**
+	 * Emit the asset registry tags that describe the content of this Joint manager. See FJointAssetRegistryTags.
+	 * Joint 2.12.0 : Added.
+	 */
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+#else
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+#endif
 	
 };
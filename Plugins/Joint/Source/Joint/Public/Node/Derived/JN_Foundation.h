@@ -24,9 +24,9 @@ public:
 	UPROPERTY(AdvancedDisplay, BlueprintReadWrite, VisibleAnywhere, Category = "Nodes")
 	TArray<TObjectPtr<UJointNodeBase>> NextNode;
 	
-public:
+protected:
 
-	virtual TArray<UJointNodeBase*> SelectNextNodes_Implementation(AJointActor* InHostingJointInstance) override;
+	virtual bool NativeSelectNextNodes(AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes) override;
 
 public:
 
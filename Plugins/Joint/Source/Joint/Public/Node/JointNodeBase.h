@@ -18,6 +18,7 @@
 class UJointManager;
 class FReply;
 class UJointFragment;
+class UJointNodeBase;
 
 /**
  * Joint node is a most basic form of the node that can be placed on the Joint manager graph.
@@ -43,6 +44,11 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJointNodeMarkedAsPending, UJointN
 
 DECLARE_DYNAMIC_DELEGATE_RetVal(TArray<FJointEdPinData>, FOnRequestJointPinData);
 
+/**
+ * Native version of the node lifecycle delegates. See UJointNodeBase::OnJointNodeBeginNative.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnJointNodeLifecycleNative, UJointNodeBase* /*Node*/);
+
 UCLASS(Abstract, Blueprintable, BlueprintType, Category = "Joint")
 class JOINT_API UJointNodeBase : public UObject, public IGameplayTagAssetInterface
 {
@@ -110,6 +116,18 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Joint")
 	FOnJointNodeMarkedAsPending OnJointNodeMarkedAsPendingDelegate;
 
+public:
+	/**
+	 * Native (non-dynamic) versions of the lifecycle delegates above. They are broadcast right before the dynamic ones.
+	 * Invoking them doesn't go through the UFunction look-up and ProcessEvent, so prefer these on C++. The dynamic ones are there for the blueprints.
+	 * Joint 2.12.0 : Added.
+	 */
+	FOnJointNodeLifecycleNative OnJointNodeBeginNative;
+
+	FOnJointNodeLifecycleNative OnJointNodeEndNative;
+
+	FOnJointNodeLifecycleNative OnJointNodeMarkedAsPendingNative;
+
 public:
 	//Check if this node is a sub node of another node. It will return true if the node is manager fragment.
 	UFUNCTION(BlueprintPure, Category = "SubNode")
@@ -339,6 +357,10 @@ public:
 	 * Notice if all the nodes on one base node returns nothing, the Joint will be finished.
 	 *
 	 * Note: The reason we provides array instead of the node instance is because we wanted to open the possible implementation using array in the logic.
+	 *
+	 * Joint 2.12.0 : The native implementation has been moved to NativeSelectNextNodes(). Override that one on C++ instead of SelectNextNodes_Implementation().
+	 * The existing C++ overrides of SelectNextNodes_Implementation() keep working, but they go through an array allocation on every selection.
+	 * The overrides are detected on the first selection of each class. An override that only passes the default selection through is treated as not overridden from then on.
 	 * 
 	 * @param InHostingJointInstance The Joint instance that is hosting this node.
 	 * @return An Array of the nodes to play on the next run. Only the first node will be selected.
@@ -346,8 +368,83 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Node")
 	TArray<UJointNodeBase*> SelectNextNodes(class AJointActor* InHostingJointInstance);
 
+	[[deprecated("Deprecated on Joint 2.12.0. Override NativeSelectNextNodes() instead. It writes the selection into the caller's array without allocating one.")]]
 	virtual TArray<UJointNodeBase*> SelectNextNodes_Implementation(class AJointActor* InHostingJointInstance);
 
+	/**
+	 * Allocation-free version of SelectNextNodes() for C++. Use this one instead of SelectNextNodes() whenever possible.
+	 * It uses NativeSelectNextNodes(), and only goes through the SelectNextNodes() event when the class has overridden it in the blueprint.
+	 *
+	 * Joint 2.12.0 : Added.
+	 *
+	 * @param InHostingJointInstance The Joint instance that is hosting this node.
+	 * @param OutNodes The nodes to play on the next run will be appended here. Only the first node will be selected.
+	 * @return Whether this node has selected any node.
+	 */
+	bool SelectNextNodesInto(class AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes);
+
+protected:
+
+	/**
+	 * Native implementation of SelectNextNodes(). Override this function to implement the branching of your node on C++.
+	 * By default, It will iterate and check sub node's selections and use the first one that is not empty.
+	 * (The default implementation goes through SelectNextNodes_Implementation() only for the classes that still override that one on C++.)
+	 *
+	 * Joint 2.12.0 : Added.
+	 *
+	 * @param InHostingJointInstance The Joint instance that is hosting this node.
+	 * @param OutNodes The nodes to play on the next run. Append the selected nodes here.
+	 * @return Whether this node has selected any node.
+	 */
+	virtual bool NativeSelectNextNodes(class AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes);
+
+private:
+
+	/**
+	 * Test through the sub nodes and use the first one that has selected something. The actual default selection of the nodes.
+	 */
+	bool SelectNextNodesFromSubNodes(class AJointActor* InHostingJointInstance, FJointNodeSelection& OutNodes);
+
+public:
+
+	/**
+	 * Collect all the base nodes that this node can possibly move to, regardless of the state of the node.
+	 * It reads the node pointer properties (such as the next node pins) of this node and all the fragments under it, so it can be used to look ahead the graph before the node is played.
+	 *
+	 * If the Joint manager has the successor table of the reachability analysis, it will be used instead.
+	 *
+	 * Joint 2.12.0 : Added for the look-ahead features such as the asset prefetching of AJointActor.
+	 *
+	 * @param OutNodes The base nodes this node can move to. The nodes will be added uniquely.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Node")
+	void GetPossibleNextNodes(TArray<UJointNodeBase*>& OutNodes);
+
+	/**
+	 * Collect the possible next nodes by reading the node pointer properties of this node and all the fragments under it, without using the reachability table.
+	 * This is what the reachability analysis is built from.
+	 *
+	 * Joint 2.12.0 : Added.
+	 *
+	 * @param OutNodes The base nodes this node can move to. The nodes will be added uniquely.
+	 */
+	void CollectPossibleNextNodesFromProperties(TArray<UJointNodeBase*>& OutNodes);
+
+	/**
+	 * Collect the soft referenced assets of this node that are worth loading ahead, before the node gets played.
+	 * Override this function to provide the assets your node will use by yourself.
+	 *
+	 * By default, it collects the soft object & class references (and the arrays of them) that are declared on the node class, except the references to the other nodes.
+	 *
+	 * Joint 2.12.0 : Added for the asset prefetching of AJointActor.
+	 *
+	 * @param OutAssetPaths The paths of the assets to prefetch.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Node|Prefetch")
+	void CollectAssetsToPrefetch(TArray<FSoftObjectPath>& OutAssetPaths);
+
+	virtual void CollectAssetsToPrefetch_Implementation(TArray<FSoftObjectPath>& OutAssetPaths);
+
 private:
 
 
@@ -543,6 +640,19 @@ protected:
 	 */
 	virtual void PostNodeMarkedAsPending_Implementation();
 
+	/**
+	 * Called when the node has been restored from a progress snapshot. (See AJointActor::RestoreProgressSnapshot())
+	 * The lifecycle states and the SaveGame properties have already been applied at this point, but none of the lifecycle events have been executed for the restoration.
+	 * Override this function to re-establish the runtime bindings the node makes on its begin play, such as the delegates bound to its sub nodes.
+	 * By default, It does nothing.
+	 *
+	 * Joint 2.12.0 : Added.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Node")
+	void PostNodeProgressRestored();
+
+	virtual void PostNodeProgressRestored_Implementation();
+
 public:
 	/**
 	 * Mark this node pending.
@@ -922,5 +1032,17 @@ public:
 	 * Returns whether we need to load this node for the provided platform.
 	 */
 	virtual bool NeedsLoadForTargetPlatform(const ITargetPlatform* TargetPlatform) const override;
+
+private:
+
+#if WITH_EDITOR
+
+	/**
+	 * Whether this node will be stripped from the cooked data since the Joint manager can never reach it. See UJointManager::bStripUnreachableNodesOnCook.
+	 * Joint 2.12.0 : Added.
+	 */
+	bool IsStrippedAsUnreachableOnCook() const;
+
+#endif
 	
 };
@@ -0,0 +1,71 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+class UJointManager;
+
+/**
+ * The asset registry tags a Joint manager emits on save.
+ *
+ * They describe what the Joint manager contains (the node & fragment classes, the number of the nodes, the referenced gameplay tags & soft assets),
+ * so the project-wide tools can filter the candidate assets with the asset registry data and load only the ones that matter.
+ * The list tags are the sorted entries joined with ListDelimiter. Use ParseList() to read them.
+ *
+ * The assets that have not been saved since these tags were introduced don't have them at all, so the tools must treat a missing tag as 'unknown' rather than 'empty'.
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+struct JOINT_API FJointAssetRegistryTags
+{
+
+public:
+
+	/** The class paths of the base nodes. */
+	static const FName NodeClasses;
+
+	/** The class paths of the fragments, including the manager fragments. */
+	static const FName FragmentClasses;
+
+	/** The number of the base nodes. */
+	static const FName NodeCount;
+
+	/** The number of the fragments, including the manager fragments. */
+	static const FName FragmentCount;
+
+	/** The gameplay tags the nodes hold on their properties. */
+	static const FName GameplayTags;
+
+	/** The soft object paths the nodes hold on their properties, except the ones that point to the Joint manager itself. */
+	static const FName SoftReferences;
+
+	/** The class paths of the editor nodes. Gathered by the editor module. */
+	static const FName EditorNodeClasses;
+
+	/** The packages of the blueprint node classes the editor nodes have been created with. Gathered by the editor module, and kept even if the class is missing at the moment. */
+	static const FName NodeClassPackages;
+
+	/** The native node classes the editor nodes have been created with - the class paths, or the class names if the class is missing at the moment. Gathered by the editor module. */
+	static const FName NativeNodeClasses;
+
+	static const TCHAR* ListDelimiter;
+
+public:
+
+	/**
+	 * Collect the tags of the provided Joint manager. The editor-only tags are added by the editor module through FJointModule::OnGatherEditorAssetRegistryTags.
+	 */
+	static void Gather(const UJointManager* InJointManager, TArray<UObject::FAssetRegistryTag>& OutTags);
+
+	/**
+	 * Make a list tag value out of the provided entries. The entries will be sorted.
+	 */
+	static FString MakeList(TArray<FString> Entries);
+
+	static void ParseList(const FString& ListValue, TArray<FString>& OutEntries);
+
+	static bool ListContains(const FString& ListValue, const FString& Entry);
+
+};
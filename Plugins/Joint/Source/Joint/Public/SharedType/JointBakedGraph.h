@@ -0,0 +1,173 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "JointBakedGraph.generated.h"
+
+class UJointManager;
+class UJointNodeBase;
+class ITargetPlatform;
+
+/**
+ * A node entry on the baked graph. All the ranges point into the flat arrays of FJointBakedGraph.
+ */
+struct JOINT_API FJointBakedNode
+{
+public:
+
+	FGuid NodeGuid;
+
+	/**
+	 * Index of the parent node on the node table. INDEX_NONE for the base nodes and the root manager fragments.
+	 */
+	int32 ParentIndex = INDEX_NONE;
+
+	/**
+	 * The nodes are laid out in the depth-first order, so the whole lower hierarchy of a node is the range [Index + 1, Index + 1 + LowerHierarchyNum).
+	 */
+	int32 LowerHierarchyNum = 0;
+
+	/**
+	 * Range of the node tags on the tag index table.
+	 */
+	int32 TagStart = 0;
+	int32 TagNum = 0;
+
+	/**
+	 * Whether this node is a manager fragment or a fragment under it.
+	 */
+	bool bIsManagerFragment = false;
+
+public:
+
+	friend FArchive& operator<<(FArchive& Ar, FJointBakedNode& Node);
+
+};
+
+
+/**
+ * Compact, index based look-up tables of a Joint manager's node hierarchy that are baked on the cook.
+ *
+ * It holds a flat node table in the depth-first order, the fragment hierarchies as the ranges, and the node tags interned into a single tag table.
+ * All of them are serialized as contiguous arrays in one go.
+ * The edges between the base nodes are not baked here - they are on the successor table of FJointReachability, which the cooked data carries as well.
+ *
+ * This is not a replacement of the node objects: the nodes are still loaded, duplicated per AJointActor and executed as they are.
+ * The baked graph only replaces the hierarchy walks & reflection based look-ups over them. (Finding the nodes by their Guids)
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+USTRUCT()
+struct JOINT_API FJointBakedGraph
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Bake the provided Joint manager.
+	 * @param InJointManager The Joint manager to bake.
+	 * @param TargetPlatform If provided, the nodes that will not be loaded for the platform will be excluded.
+	 * @return The baked graph.
+	 */
+	static FJointBakedGraph Bake(UJointManager* InJointManager, const ITargetPlatform* TargetPlatform = nullptr);
+
+public:
+
+	bool IsBaked() const;
+
+	void Reset();
+
+public:
+
+	int32 Num() const;
+
+	/**
+	 * Find the index of the node with the provided Guid on the node table. INDEX_NONE if not found.
+	 */
+	int32 FindNodeIndex(const FGuid& NodeGuid) const;
+
+	UJointNodeBase* GetNodeObject(const int32 NodeIndex) const;
+
+	const FJointBakedNode& GetNode(const int32 NodeIndex) const;
+
+	/**
+	 * Get the indices of the tags of the provided node on the interned tag table. See GetTag().
+	 */
+	TConstArrayView<int32> GetNodeTagIndices(const int32 NodeIndex) const;
+
+	const FGameplayTag& GetTag(const int32 TagIndex) const;
+
+public:
+
+	/**
+	 * The size of the baked data, in bytes.
+	 */
+	SIZE_T GetAllocatedSize() const;
+
+public:
+
+	/**
+	 * The node objects are serialized on the archive itself, and the rest of the tables are serialized as one payload after them.
+	 * The payload of the other versions is skipped as a whole on the load, leaving the graph not baked.
+	 */
+	bool Serialize(FArchive& Ar);
+
+private:
+
+	void SerializePayload(FArchive& Ar);
+
+	void RebuildGuidIndex();
+
+private:
+
+	friend struct FJointBakedGraphCookReport;
+
+private:
+
+	/**
+	 * The node objects, in the same order as the node table.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<UJointNodeBase>> NodeObjects;
+
+	TArray<FJointBakedNode> Nodes;
+
+	TArray<FGameplayTag> Tags;
+
+	TArray<int32> TagIndices;
+
+	/**
+	 * Not serialized. Rebuilt whenever the graph gets baked or loaded.
+	 */
+	TMap<FGuid, int32> GuidToIndex;
+
+	bool bIsBaked = false;
+
+};
+
+template<>
+struct TStructOpsTypeTraits<FJointBakedGraph> : public TStructOpsTypeTraitsBase2<FJointBakedGraph>
+{
+	enum
+	{
+		WithSerializer = true,
+	};
+};
+
+
+#if WITH_EDITOR
+
+/**
+ * Reports the size & load time of the baked graph of a Joint manager next to the size of its object graph, to the log and to Saved/Joint/JointBakedGraphReport.csv.
+ * The report file is rewritten on each cook.
+ * Controlled with Joint.BakedGraph.Report console variable. (0 : Off, 1 : On)
+ */
+struct JOINT_API FJointBakedGraphCookReport
+{
+	static void Write(UJointManager* InJointManager, const FJointBakedGraph& InBakedGraph, const ITargetPlatform* TargetPlatform, const double BakeSeconds);
+};
+
+#endif
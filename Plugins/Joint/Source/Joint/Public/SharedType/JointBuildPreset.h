@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "SharedType/JointSharedTypes.h"
 #include "UObject/NoExportTypes.h"
+#include "UObject/ObjectKey.h"
 #include "JointBuildPreset.generated.h"
 
 /**
@@ -74,3 +75,119 @@ public:
 #endif
 	
 };
+
+
+#if WITH_EDITOR
+
+class UJointNodeBase;
+
+/**
+ * The kinds of the inclusion queries the build presets answer.
+ */
+enum class EJointBuildPresetQuery : uint8
+{
+	Client,
+	Server,
+	BuildTarget
+};
+
+/**
+ * A cook-scoped memoization of the build preset decisions.
+ *
+ * While the cook commandlet is running, every node is asked NeedsLoadForClient(), NeedsLoadForServer() and NeedsLoadForTargetPlatform() several times per platform,
+ * and each of them used to walk up the parent chain and load the preset again. This cache keeps the resolved decision per preset and per node for each query & platform,
+ * so each of them is computed only once per cook target.
+ *
+ * Outside of the cook commandlet, the cache stays inactive and every query is evaluated as it is, since the presets & nodes can be edited at any time.
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+class JOINT_API FJointBuildPresetCache
+{
+public:
+
+	static FJointBuildPresetCache& Get();
+
+public:
+
+	/**
+	 * Whether the cache is active at this moment. It is only active while the cook commandlet is running.
+	 */
+	bool IsActive() const;
+
+public:
+
+	/**
+	 * Resolve the decision of the provided preset for the query. The preset will be loaded only once per cook.
+	 * @param Preset The preset to evaluate. A null or missing preset always allows.
+	 * @param Query Which decision to make.
+	 * @param TargetPlatform The target platform for the BuildTarget query. Ignored for the others.
+	 * @return Whether the preset allows the nodes to be included.
+	 */
+	bool Allows(const TSoftObjectPtr<UJointBuildPreset>& Preset, const EJointBuildPresetQuery Query, const ITargetPlatform* TargetPlatform = nullptr);
+
+public:
+
+	/**
+	 * Find the memoized inclusion result of the node for the query.
+	 * @return Whether the result has been found. Always false if the cache is not active.
+	 */
+	bool FindNodeDecision(const UJointNodeBase* Node, const EJointBuildPresetQuery Query, const ITargetPlatform* TargetPlatform, bool& bOutAllowed) const;
+
+	/**
+	 * Memoize the inclusion result of the node for the query. Does nothing if the cache is not active.
+	 */
+	void StoreNodeDecision(const UJointNodeBase* Node, const EJointBuildPresetQuery Query, const ITargetPlatform* TargetPlatform, const bool bAllowed);
+
+public:
+
+	/**
+	 * Forget all the memoized decisions.
+	 */
+	void Reset();
+
+private:
+
+	struct FDecisionKey
+	{
+	public:
+
+		FObjectKey Object;
+
+		FSoftObjectPath PresetPath;
+
+		const ITargetPlatform* TargetPlatform = nullptr;
+
+		EJointBuildPresetQuery Query = EJointBuildPresetQuery::Client;
+
+	public:
+
+		bool operator==(const FDecisionKey& Other) const
+		{
+			return Object == Other.Object && PresetPath == Other.PresetPath && TargetPlatform == Other.TargetPlatform && Query == Other.Query;
+		}
+
+		friend uint32 GetTypeHash(const FDecisionKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Object), GetTypeHash(Key.PresetPath));
+
+			Hash = HashCombine(Hash, GetTypeHash(Key.TargetPlatform));
+
+			return HashCombine(Hash, GetTypeHash(static_cast<uint8>(Key.Query)));
+		}
+	};
+
+	static FDecisionKey MakeKey(const UObject* Object, const FSoftObjectPath& PresetPath, const EJointBuildPresetQuery Query, const ITargetPlatform* TargetPlatform);
+
+private:
+
+	//The packages can be loaded off the game thread on the cook.
+	mutable FRWLock Lock;
+
+	TMap<FDecisionKey, bool> PresetDecisions;
+
+	TMap<FDecisionKey, bool> NodeDecisions;
+
+};
+
+#endif
@@ -0,0 +1,202 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SharedType/JointSharedTypes.h"
+
+class UJointNodeBase;
+class AJointActor;
+
+enum class EJointTraceRecordType : uint8
+{
+	// A node execution has been popped from the execution queue of the Joint actor.
+	Execution,
+	// The playing base node has selected the next nodes. Followed by 'Count' SelectedNode records.
+	Selection,
+	// One of the nodes selected by the previous Selection record.
+	SelectedNode,
+};
+
+/**
+ * A fixed size record on the execution trace.
+ */
+struct JOINT_API FJointTraceRecord
+{
+public:
+
+	/**
+	 * Seconds since the trace has started recording.
+	 */
+	double Timestamp = 0;
+
+	FGuid NodeGuid;
+
+	EJointTraceRecordType Type = EJointTraceRecordType::Execution;
+
+	EJointActorExecutionType ExecutionType = EJointActorExecutionType::None;
+
+	/**
+	 * The number of the selected nodes for the Selection records.
+	 */
+	uint16 Count = 0;
+
+public:
+
+	friend FArchive& operator<<(FArchive& Ar, FJointTraceRecord& Record);
+
+};
+
+
+/**
+ * A low-overhead binary recorder for the execution of a Joint actor.
+ *
+ * It keeps the latest records in a fixed size ring buffer, so it can be left on in the production builds where the debug logs are compiled out.
+ * The trace can be dumped to disk (Saved/Joint/Traces by default) and replayed on a Joint actor later with AJointActor::ReplayExecutionTrace().
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+class JOINT_API FJointExecutionTrace
+{
+public:
+
+	explicit FJointExecutionTrace(const int32 InCapacity = 4096);
+
+public:
+
+	void RecordExecution(const EJointActorExecutionType ExecutionType, const UJointNodeBase* Node);
+
+	void RecordSelection(const UJointNodeBase* Node, TConstArrayView<UJointNodeBase*> SelectedNodes);
+
+	void Reset();
+
+public:
+
+	/**
+	 * The number of the records the trace holds at the moment.
+	 */
+	int32 Num() const;
+
+	int32 GetCapacity() const;
+
+	/**
+	 * Whether the oldest records have been overwritten. The replay of a wrapped trace can not start from the beginning of the Joint.
+	 */
+	bool HasWrapped() const;
+
+	/**
+	 * Copy the records in the chronological order.
+	 */
+	void GetRecords(TArray<FJointTraceRecord>& OutRecords) const;
+
+public:
+
+	/**
+	 * Write the trace to the provided file. Creates the directory if needed.
+	 */
+	bool SaveToFile(const FString& FilePath) const;
+
+	/**
+	 * Read the trace from the provided file.
+	 */
+	static bool LoadFromFile(const FString& FilePath, FJointExecutionTrace& OutTrace);
+
+	/**
+	 * Get a new file path for the dump of the provided Joint actor in Saved/Joint/Traces.
+	 */
+	static FString MakeDumpFilePath(const AJointActor* InJointActor);
+
+public:
+
+	/**
+	 * The Guid of the Joint actor the trace has been recorded from.
+	 */
+	FGuid JointGuid;
+
+	/**
+	 * The Joint manager asset the Joint actor has been playing.
+	 */
+	FSoftObjectPath JointManagerPath;
+
+private:
+
+	void AddRecord(const FJointTraceRecord& Record);
+
+private:
+
+	TArray<FJointTraceRecord> Records;
+
+	/**
+	 * The index the next record will be written at.
+	 */
+	int32 Head = 0;
+
+	int32 NumRecords = 0;
+
+	bool bHasWrapped = false;
+
+	double StartSeconds = 0;
+
+};
+
+
+/**
+ * Drives a Joint actor with the decisions of a recorded trace. See AJointActor::ReplayExecutionTrace().
+ *
+ * The recorded executions are expected to happen again in the same order. The ones the Joint can not reach by itself (mostly the end play & pending of the nodes that wait for an input) are requested by force,
+ * and the next node selections are taken from the trace instead of the nodes.
+ */
+class JOINT_API FJointExecutionTraceReplay
+{
+public:
+
+	explicit FJointExecutionTraceReplay(const FJointExecutionTrace& InTrace);
+
+public:
+
+	/**
+	 * Get the next recorded execution that has not happened yet. nullptr if there is nothing left.
+	 */
+	const FJointTraceRecord* PeekExecution() const;
+
+	/**
+	 * Give up the next recorded execution. Counted as a divergence.
+	 */
+	void SkipExecution();
+
+	/**
+	 * Notify an execution that has happened on the Joint actor. Advances the replay if it matches the next recorded execution.
+	 */
+	void NotifyExecuted(const EJointActorExecutionType ExecutionType, const FGuid& NodeGuid);
+
+	/**
+	 * Take the next recorded selection of the provided node, if it is the next selection on the trace.
+	 * @return Whether there was a matching selection.
+	 */
+	bool ConsumeSelection(const FGuid& NodeGuid, TArray<FGuid, TInlineAllocator<4>>& OutSelectedNodeGuids);
+
+	bool IsFinished() const;
+
+public:
+
+	int32 GetNumReplayedExecutions() const;
+
+	int32 GetNumDivergences() const;
+
+private:
+
+	void SkipToNextExecution();
+
+private:
+
+	TArray<FJointTraceRecord> Records;
+
+	int32 ExecutionCursor = 0;
+
+	int32 SelectionCursor = 0;
+
+	int32 NumReplayedExecutions = 0;
+
+	int32 NumDivergences = 0;
+
+};
@@ -0,0 +1,52 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JointProgressSnapshot.generated.h"
+
+class UJointManager;
+
+/**
+ * A compact binary snapshot of the progress of a Joint instance.
+ *
+ * It holds the lifecycle states of the nodes (begun play / ended play / pending) keyed by the node Guids, the SaveGame properties of the nodes, and which base node was playing.
+ * Since it only holds the data of the nodes, it stays small, and can be stored in a save game or sent to another server as it is.
+ * See AJointActor::CaptureProgressSnapshot() and AJointActor::RestoreProgressSnapshot().
+ *
+ * To keep a node's runtime variable in the snapshot, mark it with SaveGame specifier. (UPROPERTY(SaveGame))
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+USTRUCT(BlueprintType)
+struct JOINT_API FJointProgressSnapshot
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * The Guid of the Joint instance the snapshot has been captured from. The restored instance will take this Guid.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, SaveGame, Category = "Joint")
+	FGuid JointGuid;
+
+	/**
+	 * The Joint manager asset the Joint instance has been playing.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, SaveGame, Category = "Joint")
+	TSoftObjectPtr<UJointManager> JointManager;
+
+	/**
+	 * The binary data of the node states.
+	 */
+	UPROPERTY(SaveGame)
+	TArray<uint8> Data;
+
+public:
+
+	bool IsValid() const;
+
+	void Reset();
+
+};
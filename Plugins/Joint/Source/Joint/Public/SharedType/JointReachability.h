@@ -0,0 +1,146 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JointReachability.generated.h"
+
+class UJointManager;
+class UJointNodeBase;
+
+/**
+ * The result of the static reachability analysis of a Joint manager's graph.
+ *
+ * It holds the successor table of the base nodes (the possible next nodes of each base node as the indices into a single flat array),
+ * the start nodes, and whether each base node can be reached from the start nodes at all.
+ * The nodes that can not be reached but are pointed by a FJointNodePointer of a live node (or a manager fragment) are kept as 'referenced' nodes, since they can still be used as a data source.
+ *
+ * The analysis is done on the compile & save of the Joint manager in the editor, so the runtime can answer the look-ahead queries without walking the node properties.
+ * This is the only edge table of the Joint manager - the baked graph (FJointBakedGraph) of the cooked data uses it as well instead of baking its own.
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+USTRUCT()
+struct JOINT_API FJointReachability
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Analyze the graph of the provided Joint manager.
+	 * @param InJointManager The Joint manager to analyze.
+	 * @return The result of the analysis.
+	 */
+	static FJointReachability Analyze(UJointManager* InJointManager);
+
+public:
+
+	bool IsValid() const;
+
+	void Reset();
+
+public:
+
+	/**
+	 * The number of the base nodes on the table.
+	 */
+	int32 Num() const;
+
+	/**
+	 * Find the index of the base node with the provided Guid on the table. INDEX_NONE if not found.
+	 */
+	int32 FindNodeIndex(const FGuid& NodeGuid) const;
+
+	const FGuid& GetNodeGuid(const int32 NodeIndex) const;
+
+	UJointNodeBase* GetNodeObject(const int32 NodeIndex) const;
+
+	/**
+	 * Get the indices of the base nodes the provided base node can possibly move to.
+	 */
+	TConstArrayView<int32> GetSuccessorIndices(const int32 NodeIndex) const;
+
+	TConstArrayView<int32> GetStartNodeIndices() const;
+
+public:
+
+	/**
+	 * Whether the provided base node can be reached from the start nodes of the Joint manager.
+	 */
+	bool IsReachableFromStart(const int32 NodeIndex) const;
+
+	/**
+	 * Whether the provided base node is used by the Joint at all - reachable from the start nodes, or referenced by a FJointNodePointer of the nodes that are.
+	 * The nodes that are not live can be stripped from the cooked data safely.
+	 */
+	bool IsNodeLive(const int32 NodeIndex) const;
+
+	/**
+	 * Whether the Joint can move from the provided base node to the other base node by following the possible next nodes. A node can always reach itself.
+	 */
+	bool CanReach(const FGuid& FromNodeGuid, const FGuid& ToNodeGuid) const;
+
+	/**
+	 * Collect the Guids of the base nodes that are not live. See IsNodeLive().
+	 */
+	void GetUnreachableNodeGuids(TArray<FGuid>& OutNodeGuids) const;
+
+public:
+
+	SIZE_T GetAllocatedSize() const;
+
+public:
+
+	/**
+	 * The node objects are serialized on the archive itself, and the rest of the table is serialized as one payload after them.
+	 * The payload of the other versions is skipped as a whole on the load, leaving the table invalid until the next analysis.
+	 */
+	bool Serialize(FArchive& Ar);
+
+private:
+
+	void SerializePayload(FArchive& Ar);
+
+	void RebuildGuidIndex();
+
+	bool HasFlag(const int32 NodeIndex, const uint8 Flag) const;
+
+private:
+
+	/**
+	 * The base node objects, in the same order as the table.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<UJointNodeBase>> NodeObjects;
+
+	TArray<FGuid> NodeGuids;
+
+	/**
+	 * The successors of the node N are the range [SuccessorOffsets[N], SuccessorOffsets[N + 1]) of the Successors array.
+	 */
+	TArray<int32> SuccessorOffsets;
+
+	TArray<int32> Successors;
+
+	TArray<int32> StartNodeIndices;
+
+	TArray<uint8> NodeFlags;
+
+	/**
+	 * Not serialized. Rebuilt whenever the graph gets analyzed or loaded.
+	 */
+	TMap<FGuid, int32> GuidToIndex;
+
+	bool bIsValid = false;
+
+};
+
+template<>
+struct TStructOpsTypeTraits<FJointReachability> : public TStructOpsTypeTraitsBase2<FJointReachability>
+{
+	enum
+	{
+		WithSerializer = true,
+	};
+};
@@ -17,6 +17,12 @@
 
 class UJointNodeBase;
 class AJointActor;
+
+/**
+ * The selected next nodes. Most of the selections have only a few candidates, so they will stay in the inline storage without any heap allocation.
+ */
+using FJointNodeSelection = TArray<UJointNodeBase*, TInlineAllocator<4>>;
+
 class UTexture2D;
 
 class UActorComponent;
@@ -53,6 +53,24 @@ public:
 		TSubclassOf<AJointActor> OptionalJointInstanceSubclass
 	);
 	
+
+	/**
+	 * Create a new Joint instance from a progress snapshot. The Joint manager asset on the snapshot will be loaded if needed.
+	 * The progress of the snapshot is restored into the new instance right away, so don't call StartJoint() on it if the snapshot has been captured from a started Joint.
+	 * See AJointActor::RestoreProgressSnapshot() for the details.
+	 * @param WorldContextObject An object that this function will grab the world from. You can provide the subsystem itself. (In Blueprint, it will be automatically filled out.)
+	 * @param Snapshot The progress snapshot to restore.
+	 * @param OptionalJointInstanceSubclass A subclass of the Joint actor to create. If none specified, it will use AJointActor.
+	 * @return A new Joint actor that has been restored from the snapshot. nullptr if failed.
+	 *
+	 * Joint 2.12.0 : Added.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Joint", meta=(WorldContext="WorldContextObject"))
+	static AJointActor* CreateJointFromSnapshot(
+		UObject* WorldContextObject,
+		const FJointProgressSnapshot& Snapshot,
+		TSubclassOf<AJointActor> OptionalJointInstanceSubclass
+	);
 	
 	/**
 	 * Find and return the Joint for the provided Joint ID.
@@ -0,0 +1,366 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+
+#include "Editor/Commandlet/JointTraversalBenchmarkCommandlet.h"
+
+#include "JointActor.h"
+#include "JointEditorLogChannels.h"
+#include "JointManager.h"
+#include "Node/JointNodeBase.h"
+#include "SubSystem/JointSubsystem.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/RandomStream.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectArray.h"
+
+namespace JointTraversalBenchmark
+{
+	enum class EMode : uint8
+	{
+		Random,
+		Exhaustive,
+	};
+
+	struct FSettings
+	{
+		EMode Mode = EMode::Random;
+
+		int32 Runs = 8;
+
+		int32 MaxSteps = 256;
+
+		int32 Seed = 0;
+
+		FString Filter;
+
+		FString OutputDir;
+	};
+
+	struct FAssetResult
+	{
+		FString AssetPath;
+
+		int32 NumBaseNodes = 0;
+
+		int32 NumRuns = 0;
+
+		// Runs that hit MaxSteps before the Joint ended.
+		int32 NumTruncatedRuns = 0;
+
+		int32 NumBaseNodesPlayed = 0;
+
+		int32 NumCoveredBranches = 0;
+
+		double InstantiateMilliseconds = 0;
+
+		TArray<double> StepMicroseconds;
+
+		int32 PeakExecutionQueueDepth = 0;
+
+		int32 PeakUObjectCount = 0;
+
+		int64 PeakMemoryDeltaBytes = 0;
+
+		FString Error;
+
+	public:
+
+		double GetTotalStepMicroseconds() const
+		{
+			double Total = 0;
+
+			for (const double Microseconds : StepMicroseconds) Total += Microseconds;
+
+			return Total;
+		}
+
+		double GetStepPercentile(const float Percentile) const
+		{
+			if (StepMicroseconds.IsEmpty()) return 0;
+
+			TArray<double> Sorted = StepMicroseconds;
+			Sorted.Sort();
+
+			return Sorted[FMath::Clamp(FMath::FloorToInt(Percentile * (Sorted.Num() - 1)), 0, Sorted.Num() - 1)];
+		}
+	};
+
+	int64 GetUsedMemory()
+	{
+		return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+	}
+
+	FAssetResult BenchmarkAsset(UWorld* World, UJointManager* JointManager, const FSettings& Settings, FRandomStream& Random)
+	{
+		FAssetResult Result;
+		Result.AssetPath = JointManager->GetPathName();
+		Result.NumBaseNodes = JointManager->Nodes.Num();
+
+		TMap<TPair<FGuid, FGuid>, int32> BranchCounts;
+
+		const int64 BaselineMemory = GetUsedMemory();
+
+		auto SampleExecutionQueue = [&Result](AJointActor* InJointActor, UJointNodeBase* InNode)
+		{
+			Result.PeakExecutionQueueDepth = FMath::Max(Result.PeakExecutionQueueDepth, InJointActor->ExecutionQueue.Num());
+		};
+
+		for (int32 Run = 0; Run < Settings.Runs; ++Run)
+		{
+			const int32 NumCoveredBranchesBefore = BranchCounts.Num();
+
+			const double InstantiateStartSeconds = FPlatformTime::Seconds();
+
+			AJointActor* JointActor = UJointSubsystem::CreateJoint(World, JointManager, nullptr);
+
+			Result.InstantiateMilliseconds += (FPlatformTime::Seconds() - InstantiateStartSeconds) * 1000.0;
+
+			if (JointActor == nullptr)
+			{
+				Result.Error = TEXT("Failed to create the Joint actor");
+
+				break;
+			}
+
+			//Measure the traversal itself only.
+			JointActor->bPrefetchAssets = false;
+
+			JointActor->NextNodeSelectionOverride.BindLambda([&Settings, &Random, &BranchCounts](UJointNodeBase* PlayingNode, FJointNodeSelection& OutNodes) -> bool
+			{
+				TArray<UJointNodeBase*> Candidates;
+				PlayingNode->GetPossibleNextNodes(Candidates);
+				Candidates.Remove(nullptr);
+
+				//Let the node end the Joint by itself.
+				if (Candidates.IsEmpty()) return false;
+
+				UJointNodeBase* PickedNode = Candidates[0];
+
+				if (Settings.Mode == EMode::Random)
+				{
+					PickedNode = Candidates[Random.RandRange(0, Candidates.Num() - 1)];
+				}
+				else
+				{
+					int32 LeastCount = MAX_int32;
+
+					for (UJointNodeBase* Candidate : Candidates)
+					{
+						const int32 Count = BranchCounts.FindRef(TPair<FGuid, FGuid>(PlayingNode->NodeGuid, Candidate->NodeGuid));
+
+						if (Count < LeastCount)
+						{
+							LeastCount = Count;
+							PickedNode = Candidate;
+						}
+					}
+				}
+
+				++BranchCounts.FindOrAdd(TPair<FGuid, FGuid>(PlayingNode->NodeGuid, PickedNode->NodeGuid));
+
+				OutNodes.Add(PickedNode);
+
+				return true;
+			});
+
+			JointActor->OnJointNodeBeginPlayNative.AddLambda([&Result, SampleExecutionQueue](AJointActor* InJointActor, UJointNodeBase* InNode)
+			{
+				if (InNode && InNode->GetParentNode() == nullptr) ++Result.NumBaseNodesPlayed;
+
+				SampleExecutionQueue(InJointActor, InNode);
+			});
+			JointActor->OnJointNodeEndPlayNative.AddLambda(SampleExecutionQueue);
+			JointActor->OnJointNodeMarkedAsPendingNative.AddLambda(SampleExecutionQueue);
+
+			JointActor->StartJoint();
+
+			int32 NumSteps = 0;
+
+			//Everything runs synchronously until a node waits for something. End the playing node by force to move on.
+			while (!JointActor->IsJointEnded() && JointActor->GetPlayingJointNode() != nullptr && NumSteps < Settings.MaxSteps)
+			{
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+
+				JointActor->RequestNodeEndPlay(JointActor->GetPlayingJointNode());
+
+				Result.StepMicroseconds.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+
+				Result.PeakUObjectCount = FMath::Max(Result.PeakUObjectCount, GUObjectArray.GetObjectArrayNumMinusAvailable());
+				Result.PeakMemoryDeltaBytes = FMath::Max(Result.PeakMemoryDeltaBytes, GetUsedMemory() - BaselineMemory);
+
+				++NumSteps;
+			}
+
+			if (!JointActor->IsJointEnded())
+			{
+				if (NumSteps >= Settings.MaxSteps) ++Result.NumTruncatedRuns;
+
+				JointActor->EndJoint();
+			}
+
+			JointActor->NextNodeSelectionOverride.Unbind();
+			JointActor->Destroy();
+
+			++Result.NumRuns;
+
+			//Stop once a run doesn't find anything new.
+			if (Settings.Mode == EMode::Exhaustive && BranchCounts.Num() == NumCoveredBranchesBefore) break;
+		}
+
+		Result.NumCoveredBranches = BranchCounts.Num();
+
+		return Result;
+	}
+
+	FString EscapeJson(const FString& InString)
+	{
+		return InString.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\""));
+	}
+
+	void WriteReports(const TArray<FAssetResult>& Results, const FSettings& Settings)
+	{
+		FString Csv = TEXT("AssetPath,BaseNodes,Runs,TruncatedRuns,BaseNodesPlayed,CoveredBranches,Steps,InstantiateAvgMs,StepTotalUs,StepAvgUs,StepP50Us,StepP95Us,StepMaxUs,PeakExecutionQueueDepth,PeakUObjectCount,PeakMemoryDeltaKB,Error\n");
+
+		FString Json = FString::Printf(TEXT("{\n\t\"mode\": \"%s\",\n\t\"seed\": %d,\n\t\"assets\": [\n"), Settings.Mode == EMode::Random ? TEXT("Random") : TEXT("Exhaustive"), Settings.Seed);
+
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FAssetResult& Result = Results[Index];
+
+			const double TotalUs = Result.GetTotalStepMicroseconds();
+			const double AvgUs = Result.StepMicroseconds.IsEmpty() ? 0 : TotalUs / Result.StepMicroseconds.Num();
+			const double InstantiateAvgMs = Result.NumRuns > 0 ? Result.InstantiateMilliseconds / Result.NumRuns : 0;
+			const double P50Us = Result.GetStepPercentile(0.5f);
+			const double P95Us = Result.GetStepPercentile(0.95f);
+			const double MaxUs = Result.GetStepPercentile(1.f);
+			const int64 PeakMemoryDeltaKB = Result.PeakMemoryDeltaBytes / 1024;
+
+			Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%d,%d,%.3f,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%d,%lld,%s\n"),
+				*Result.AssetPath, Result.NumBaseNodes, Result.NumRuns, Result.NumTruncatedRuns, Result.NumBaseNodesPlayed, Result.NumCoveredBranches, Result.StepMicroseconds.Num(),
+				InstantiateAvgMs, TotalUs, AvgUs, P50Us, P95Us, MaxUs,
+				Result.PeakExecutionQueueDepth, Result.PeakUObjectCount, PeakMemoryDeltaKB, *Result.Error);
+
+			Json += FString::Printf(TEXT("\t\t{\"assetPath\": \"%s\", \"baseNodes\": %d, \"runs\": %d, \"truncatedRuns\": %d, \"baseNodesPlayed\": %d, \"coveredBranches\": %d, \"steps\": %d, \"instantiateAvgMs\": %.3f, \"stepTotalUs\": %.2f, \"stepAvgUs\": %.2f, \"stepP50Us\": %.2f, \"stepP95Us\": %.2f, \"stepMaxUs\": %.2f, \"peakExecutionQueueDepth\": %d, \"peakUObjectCount\": %d, \"peakMemoryDeltaKB\": %lld, \"error\": \"%s\"}%s\n"),
+				*EscapeJson(Result.AssetPath), Result.NumBaseNodes, Result.NumRuns, Result.NumTruncatedRuns, Result.NumBaseNodesPlayed, Result.NumCoveredBranches, Result.StepMicroseconds.Num(),
+				InstantiateAvgMs, TotalUs, AvgUs, P50Us, P95Us, MaxUs,
+				Result.PeakExecutionQueueDepth, Result.PeakUObjectCount, PeakMemoryDeltaKB, *EscapeJson(Result.Error),
+				Index + 1 < Results.Num() ? TEXT(",") : TEXT(""));
+		}
+
+		Json += TEXT("\t]\n}\n");
+
+		const FString CsvPath = Settings.OutputDir / TEXT("JointTraversalBenchmark.csv");
+		const FString JsonPath = Settings.OutputDir / TEXT("JointTraversalBenchmark.json");
+
+		FFileHelper::SaveStringToFile(Csv, *CsvPath);
+		FFileHelper::SaveStringToFile(Json, *JsonPath);
+
+		UE_LOG(LogJointEditor, Display, TEXT("Joint traversal benchmark: Wrote the reports of %d asset(s) to %s and %s."), Results.Num(), *CsvPath, *JsonPath);
+	}
+}
+
+UJointTraversalBenchmarkCommandlet::UJointTraversalBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UJointTraversalBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace JointTraversalBenchmark;
+
+	FSettings Settings;
+
+	FString ModeString;
+	if (FParse::Value(*Params, TEXT("Mode="), ModeString) && ModeString.Equals(TEXT("Exhaustive"), ESearchCase::IgnoreCase)) Settings.Mode = EMode::Exhaustive;
+
+	FParse::Value(*Params, TEXT("Runs="), Settings.Runs);
+	FParse::Value(*Params, TEXT("MaxSteps="), Settings.MaxSteps);
+	FParse::Value(*Params, TEXT("Seed="), Settings.Seed);
+	FParse::Value(*Params, TEXT("Filter="), Settings.Filter);
+
+	if (!FParse::Value(*Params, TEXT("Output="), Settings.OutputDir)) Settings.OutputDir = FPaths::ProjectSavedDir() / TEXT("Joint") / TEXT("Benchmark");
+
+	Settings.Runs = FMath::Max(Settings.Runs, 1);
+	Settings.MaxSteps = FMath::Max(Settings.MaxSteps, 1);
+
+	//Find all the Joint managers.
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.bRecursiveClasses = true;
+
+#if UE_VERSION_OLDER_THAN(5,1,0)
+	Filter.ClassNames.Add(UJointManager::StaticClass()->GetFName());
+#else
+	Filter.ClassPaths.Add(UJointManager::StaticClass()->GetClassPathName());
+#endif
+
+	if (!Settings.Filter.IsEmpty())
+	{
+		Filter.PackagePaths.Add(FName(*Settings.Filter));
+		Filter.bRecursivePaths = true;
+	}
+
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry.GetAssets(Filter, AssetDataList);
+
+	UE_LOG(LogJointEditor, Display, TEXT("Joint traversal benchmark: Found %d Joint manager(s)."), AssetDataList.Num());
+
+	//A minimal game world to play the Joints in.
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("JointTraversalBenchmarkWorld"));
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	FRandomStream Random(Settings.Seed);
+
+	TArray<FAssetResult> Results;
+	Results.Reserve(AssetDataList.Num());
+
+	for (const FAssetData& AssetData : AssetDataList)
+	{
+		UJointManager* JointManager = Cast<UJointManager>(AssetData.GetAsset());
+
+		if (JointManager == nullptr)
+		{
+			FAssetResult& Result = Results.AddDefaulted_GetRef();
+			Result.AssetPath = AssetData.PackageName.ToString();
+			Result.Error = TEXT("Failed to load the asset");
+
+			continue;
+		}
+
+		Results.Add(BenchmarkAsset(World, JointManager, Settings, Random));
+
+		UE_LOG(LogJointEditor, Display, TEXT("Joint traversal benchmark: %s - %d step(s), %.2f us in total."), *Results.Last().AssetPath, Results.Last().StepMicroseconds.Num(), Results.Last().GetTotalStepMicroseconds());
+
+		//Start each asset from a clean state.
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	//The slowest graphs first.
+	Results.Sort([](const FAssetResult& A, const FAssetResult& B)
+	{
+		return A.GetTotalStepMicroseconds() > B.GetTotalStepMicroseconds();
+	});
+
+	WriteReports(Results, Settings);
+
+	return 0;
+}
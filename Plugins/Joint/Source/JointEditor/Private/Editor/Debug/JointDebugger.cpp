@@ -188,17 +188,26 @@ static bool AreAllGameWorldPaused()
 void UJointDebugger::GetMatchingInstances(UJointManager* JointManager,
                                           TArray<AJointActor*>& MatchingInstances)
 {
-	for (TWeakObjectPtr<AJointActor> KnownJointInstance : KnownJointInstances)
-	{
-		if (KnownJointInstance == nullptr) continue;
+	const TArray<TWeakObjectPtr<AJointActor>>* Instances = FindMatchingInstances(JointManager);
+
+	if (Instances == nullptr) return;
 
-		if (KnownJointInstance->OriginalJointManager == JointManager)
+	for (const TWeakObjectPtr<AJointActor>& Instance : *Instances)
+	{
+		if (AJointActor* ResolvedInstance = Instance.Get())
 		{
-			MatchingInstances.Add(KnownJointInstance.Get());
+			MatchingInstances.Add(ResolvedInstance);
 		}
 	}
 }
 
+const TArray<TWeakObjectPtr<AJointActor>>* UJointDebugger::FindMatchingInstances(const UJointManager* JointManager) const
+{
+	if (JointManager == nullptr) return nullptr;
+
+	return KnownInstancesByManager.Find(FObjectKey(JointManager));
+}
+
 FText UJointDebugger::GetInstanceDescription(AJointActor* Instance) const
 {
 	FText ActorDesc = LOCTEXT("InstanceDescription_Default",
@@ -376,14 +385,21 @@ void UJointDebugger::NotifyDebugDataChanged(const UJointManager* Manager)
 void UJointDebugger::NotifyDebugDataChangedToGraphNodeWidget(UJointEdGraphNode* Changed, FJointNodeDebugData* Data)
 {
 	if (Changed == nullptr) return;
-	
-	UJointManager* ChangedManager = Changed->GetJointManager();
+
+	UJointDebugger* Debugger = UJointDebugger::Get();
+
+	const UJointNodeBase* ChangedNodeInstance = Changed->GetCastedNodeInstance();
+
+	if (Debugger == nullptr || ChangedNodeInstance == nullptr) return;
+
+	const FGuid& NodeGuid = ChangedNodeInstance->GetNodeGuid();
+
 	UJointManager* OriginalJointManager = FJointEdUtils::GetOriginalJointManager(Changed->GetJointManager());
 	
 	// when changed node is from an asset...
 		
 	// change the original asset node's widget first.
-	if (UJointEdGraphNode* FoundEdGraphNode = FJointEdUtils::GetCorrespondingJointGraphNodeForJointManager(Changed, OriginalJointManager))
+	if (UJointEdGraphNode* FoundEdGraphNode = Debugger->FindGraphNodeForNodeGuid(OriginalJointManager, NodeGuid))
 	{
 		if (TSharedPtr<SJointGraphNodeBase> GraphNodeSlate = FoundEdGraphNode->GetGraphNodeSlate().Pin())
 		{
@@ -392,13 +408,16 @@ void UJointDebugger::NotifyDebugDataChangedToGraphNodeWidget(UJointEdGraphNode*
 	}
 	
 	// find joint actor instances that are debugging this node and notify their toolkits too.
+
+	const TArray<TWeakObjectPtr<AJointActor>>* MatchingInstances = Debugger->FindMatchingInstances(OriginalJointManager);
+
+	if (MatchingInstances == nullptr) return;
 	
-	TArray<AJointActor*> MatchingInstances;
-	UJointDebugger::Get()->GetMatchingInstances(OriginalJointManager, MatchingInstances);
-	
-	for (AJointActor* Instance : MatchingInstances)
+	for (const TWeakObjectPtr<AJointActor>& Instance : *MatchingInstances)
 	{
-		UJointEdGraphNode* FoundEdGraphNode = FJointEdUtils::GetCorrespondingJointGraphNodeForJointManager(Changed, Instance->GetJointManager());
+		if (!Instance.IsValid()) continue;
+
+		UJointEdGraphNode* FoundEdGraphNode = Debugger->FindGraphNodeForNodeGuid(Instance->GetJointManager(), NodeGuid);
 		
 		if (!FoundEdGraphNode) continue;
 		
@@ -415,13 +434,23 @@ TArray<FJointNodeDebugData>* UJointDebugger::GetCorrespondingDebugDataForGraph(U
 
 	if (Graph == nullptr) return OutDebugData;
 
+	UJointDebugger* Debugger = UJointDebugger::Get();
+
+	if (Debugger != nullptr)
+	{
+		if (const TWeakObjectPtr<UJointEdGraph>* FoundGraph = Debugger->DebugDataGraphIndex.Find(FObjectKey(Graph)); FoundGraph && FoundGraph->IsValid())
+		{
+			return &FoundGraph->Get()->DebugData;
+		}
+	}
+
 	UJointManager* JointManagerToSearchFrom = FJointEdUtils::GetOriginalJointManager(Graph->GetJointManager());
 	
 	//find the corresponding graph from the original Joint manager - probably via path name comparison.
 
 	if (JointManagerToSearchFrom == nullptr) return OutDebugData;
 	
-	TArray<UJointEdGraph*> AllGraphs = UJointEdGraph::GetAllGraphsFrom(JointManagerToSearchFrom);
+	const TArray<UJointEdGraph*>& AllGraphs = UJointEdGraph::GetCachedGraphsFrom(JointManagerToSearchFrom);
 
 	const FString& InGraphPath = Graph->GetPathName(Graph->GetJointManager());
 	
@@ -433,12 +462,87 @@ TArray<FJointNodeDebugData>* UJointDebugger::GetCorrespondingDebugDataForGraph(U
 
 		OutDebugData = &IterGraph->DebugData;
 
+		//Remember the result, so the next look-up for this graph doesn't compare the paths again.
+		if (Debugger != nullptr) Debugger->DebugDataGraphIndex.Add(FObjectKey(Graph), IterGraph);
+
 		break;
 	}
 
 	return OutDebugData;
 }
 
+UJointEdGraphNode* UJointDebugger::FindGraphNodeForNodeGuid(UJointManager* JointManager, const FGuid& NodeGuid)
+{
+	if (JointManager == nullptr || !NodeGuid.IsValid()) return nullptr;
+
+	const FObjectKey ManagerKey(JointManager);
+
+	TMap<FGuid, TWeakObjectPtr<UJointEdGraphNode>>* Index = GraphNodeIndex.Find(ManagerKey);
+
+	if (Index == nullptr)
+	{
+		Index = &GraphNodeIndex.Add(ManagerKey);
+
+		BuildGraphNodeIndexFor(JointManager, *Index);
+	}
+
+	const TWeakObjectPtr<UJointEdGraphNode>* Found = Index->Find(NodeGuid);
+
+	if (Found == nullptr) return nullptr;
+
+	UJointEdGraphNode* FoundNode = Found->Get();
+
+	//The graph node has been destroyed without an edit on the graph (e.g. the instance has been reloaded). Index the manager again.
+	if (FoundNode == nullptr)
+	{
+		BuildGraphNodeIndexFor(JointManager, *Index);
+
+		Found = Index->Find(NodeGuid);
+
+		FoundNode = Found ? Found->Get() : nullptr;
+	}
+
+	return FoundNode;
+}
+
+void UJointDebugger::BuildGraphNodeIndexFor(UJointManager* JointManager, TMap<FGuid, TWeakObjectPtr<UJointEdGraphNode>>& OutIndex) const
+{
+	OutIndex.Reset();
+
+	for (UJointEdGraph* Graph : UJointEdGraph::GetCachedGraphsFrom(JointManager))
+	{
+		if (Graph == nullptr) continue;
+
+		for (const TWeakObjectPtr<UJointEdGraphNode>& GraphNode : Graph->GetCachedJointGraphNodes())
+		{
+			if (!GraphNode.IsValid()) continue;
+
+			if (const UJointNodeBase* NodeInstance = GraphNode->GetCastedNodeInstance())
+			{
+				OutIndex.Add(NodeInstance->GetNodeGuid(), GraphNode);
+			}
+		}
+	}
+}
+
+void UJointDebugger::InvalidateDebugLookUpFor(const UJointManager* JointManager)
+{
+	if (JointManager == nullptr) return;
+
+	//Don't load the module for this - there is nothing to invalidate if the debugger doesn't exist yet.
+	FJointEditorModule* Module = FModuleManager::GetModulePtr<FJointEditorModule>("JointEditor");
+
+	UJointDebugger* Debugger = Module ? Module->JointDebugger : nullptr;
+
+	if (Debugger == nullptr) return;
+
+	Debugger->GraphNodeIndex.Remove(FObjectKey(JointManager));
+
+	//The graphs can be added, removed or moved around on the edit. It's cheap to find them again.
+	Debugger->DebugDataGraphIndex.Reset();
+	Debugger->DebugDataIndex.Reset();
+}
+
 FJointNodeDebugData* UJointDebugger::GetDebugDataForInstance(UJointEdGraphNode* Node)
 {
 	if (!Node) return nullptr;
@@ -467,7 +571,7 @@ void UJointDebugger::OnJointNodeBeginPlayed(AJointActor* JointActor, UJointNodeB
 	{
 		if (const FJointEditorToolkit* Toolkit = FJointEdUtils::FindOrOpenJointEditorInstanceFor(JointActor->GetJointManager(), false, false); !Toolkit) return;
 
-		if (UJointEdGraphNode* OriginalNode = FJointEdUtils::FindGraphNodeWithProvidedNodeInstanceGuid(JointActor->GetJointManager(), JointNodeBase->GetNodeGuid()))
+		if (UJointEdGraphNode* OriginalNode = FindGraphNodeForNodeGuid(JointActor->GetJointManager(), JointNodeBase->GetNodeGuid()))
 		{
 			if (const UJointEditorSettings* EditorSettings = UJointEditorSettings::Get())
 			{
@@ -488,7 +592,7 @@ void UJointDebugger::OnJointNodeEndPlayed(AJointActor* JointActor, UJointNodeBas
 	{
 		if (const FJointEditorToolkit* Toolkit = FJointEdUtils::FindOrOpenJointEditorInstanceFor(JointActor->GetJointManager(), false, false); !Toolkit) return;
 
-		if (UJointEdGraphNode* OriginalNode = FJointEdUtils::FindGraphNodeWithProvidedNodeInstanceGuid(JointActor->GetJointManager(), JointNodeBase->GetNodeGuid()))
+		if (UJointEdGraphNode* OriginalNode = FindGraphNodeForNodeGuid(JointActor->GetJointManager(), JointNodeBase->GetNodeGuid()))
 		{
 			if (const UJointEditorSettings* EditorSettings = UJointEditorSettings::Get())
 			{
@@ -509,7 +613,7 @@ void UJointDebugger::OnJointNodePending(AJointActor* JointActor, UJointNodeBase*
 	{
 		if (const FJointEditorToolkit* Toolkit = FJointEdUtils::FindOrOpenJointEditorInstanceFor(JointActor->GetJointManager(), false, false); !Toolkit) return;
 		
-		if (UJointEdGraphNode* OriginalNode = FJointEdUtils::FindGraphNodeWithProvidedNodeInstanceGuid(JointActor->GetJointManager(), JointNodeBase->GetNodeGuid()))
+		if (UJointEdGraphNode* OriginalNode = FindGraphNodeForNodeGuid(JointActor->GetJointManager(), JointNodeBase->GetNodeGuid()))
 		{
 			if (const UJointEditorSettings* EditorSettings = UJointEditorSettings::Get())
 			{
@@ -644,7 +748,7 @@ void UJointDebugger::PlayPauseNodeAnimation(const UJointNodeBase* Node)
 	{
 		if (const FJointEditorToolkit* Toolkit = FJointEdUtils::FindOrOpenJointEditorInstanceFor(JointActor->GetJointManager(), false, false); !Toolkit) return;
 
-		if (UJointEdGraphNode* OriginalNode = FJointEdUtils::FindGraphNodeWithProvidedNodeInstanceGuid(JointActor->GetJointManager(), Node->GetNodeGuid()))
+		if (UJointEdGraphNode* OriginalNode = FindGraphNodeForNodeGuid(JointActor->GetJointManager(), Node->GetNodeGuid()))
 		{
 			if (const UJointEditorSettings* EditorSettings = UJointEditorSettings::Get())
 			{
@@ -717,6 +821,11 @@ void UJointDebugger::AssignInstanceToKnownInstance(AJointActor* Instance)
 	{
 		KnownJointInstances.Add(Instance);
 
+		if (Instance != nullptr && Instance->OriginalJointManager != nullptr)
+		{
+			KnownInstancesByManager.FindOrAdd(FObjectKey(Instance->OriginalJointManager)).AddUnique(Instance);
+		}
+
 		OnInstanceAddedToKnownInstance(Instance);
 	}
 }
@@ -727,6 +836,15 @@ void UJointDebugger::RemoveInstanceFromKnownInstance(AJointActor* Instance)
 	{
 		KnownJointInstances.Remove(Instance);
 
+		for (auto It = KnownInstancesByManager.CreateIterator(); It; ++It)
+		{
+			It.Value().Remove(Instance);
+
+			if (It.Value().IsEmpty()) It.RemoveCurrent();
+		}
+
+		if (Instance != nullptr) GraphNodeIndex.Remove(FObjectKey(Instance->GetJointManager()));
+
 		OnInstanceRemovedFromKnownInstance(Instance);
 	}
 }
@@ -744,6 +862,11 @@ void UJointDebugger::ClearDebugSessionData()
 	DebuggingJointInstances.Empty();
 	KnownJointInstances.Empty();
 
+	GraphNodeIndex.Empty();
+	DebugDataGraphIndex.Empty();
+	DebugDataIndex.Empty();
+	KnownInstancesByManager.Empty();
+
 	ClearStepActionRequest();
 }
 
@@ -842,56 +965,69 @@ void UJointDebugger::RestartExecutionOfPausedJointActors()
 
 FJointNodeDebugData* UJointDebugger::GetDebugDataForInstanceFrom(TArray<FJointNodeDebugData>* TargetDataArrayPtr, UJointEdGraphNode* Node)
 {
-	FJointNodeDebugData* OutDebugData = nullptr;
-
 	if (!Node || !TargetDataArrayPtr) return nullptr;
 
 	UJointNodeBase* InNode = Node->GetCastedNodeInstance();
 
 	if (!InNode) return nullptr;
 
-	FString RelPath = InNode->GetPathName(InNode->GetJointManager());
+	return GetDebugDataForInstanceFrom(TargetDataArrayPtr, InNode);
+}
 
-	for (FJointNodeDebugData& Data : *TargetDataArrayPtr)
-	{
-		if (Data.Node == nullptr || Data.Node->GetCastedNodeInstance() == nullptr || Data.Node->GetCastedNodeInstance()->GetJointManager() == nullptr) continue;
 
-		//UE_LOG(LogJointEditor,Log,TEXT("Path1 %s, Path2 %s"),*Data.Node->GetCastedNodeInstance()->GetPathName(Data.Node->GetJointManager()), *RelPath);
+FJointNodeDebugData* UJointDebugger::GetDebugDataForInstanceFrom(TArray<FJointNodeDebugData>* TargetDataArrayPtr, UJointNodeBase* NodeInstance)
+{
+	if (!NodeInstance || !TargetDataArrayPtr || TargetDataArrayPtr->IsEmpty()) return nullptr;
 
-		if (Data.Node->GetCastedNodeInstance()->GetPathName(Data.Node->GetJointManager()) != RelPath) continue;
+	UJointDebugger* Debugger = UJointDebugger::Get();
 
-		OutDebugData = &Data;
+	if (Debugger == nullptr) return nullptr;
 
-		break;
-	}
-	
-	return OutDebugData;
-}
+	FDebugDataIndex& Index = Debugger->DebugDataIndex.FindOrAdd(TargetDataArrayPtr);
 
+	if (Index.Data != TargetDataArrayPtr->GetData() || Index.Num != TargetDataArrayPtr->Num()) BuildDebugDataIndexFor(*TargetDataArrayPtr, Index);
 
-FJointNodeDebugData* UJointDebugger::GetDebugDataForInstanceFrom(TArray<FJointNodeDebugData>* TargetDataArrayPtr, UJointNodeBase* NodeInstance)
-{
-	FJointNodeDebugData* OutDebugData = nullptr;
-	
-	if (!NodeInstance || !TargetDataArrayPtr) return nullptr;
+	//The node instances of the Joint actors are the duplicates of the asset's, so they share the Guids with the original nodes.
+	const FGuid& NodeGuid = NodeInstance->GetNodeGuid();
 
-	FString RelPath = NodeInstance->GetPathName(NodeInstance->GetJointManager());
+	const int32* FoundIndex = Index.Index.Find(NodeGuid);
 
-	for (FJointNodeDebugData& Data : *TargetDataArrayPtr)
+	if (FoundIndex == nullptr) return nullptr;
+
+	FJointNodeDebugData& Data = (*TargetDataArrayPtr)[*FoundIndex];
+
+	//The element has been replaced in place (e.g. by an undo). Index the array again.
+	if (Data.Node == nullptr || Data.Node->GetCastedNodeInstance() == nullptr || Data.Node->GetCastedNodeInstance()->GetNodeGuid() != NodeGuid)
 	{
-		if (Data.Node == nullptr || Data.Node->GetCastedNodeInstance() == nullptr || Data.Node->GetCastedNodeInstance()->GetJointManager() == nullptr)
-			continue;
+		BuildDebugDataIndexFor(*TargetDataArrayPtr, Index);
 
-		//UE_LOG(LogJointEditor,Log,TEXT("Path1 %s, Path2 %s"),*Data.Node->GetCastedNodeInstance()->GetPathName(Data.Node->GetJointManager()), *RelPath);
+		FoundIndex = Index.Index.Find(NodeGuid);
 
-		if (Data.Node->GetCastedNodeInstance()->GetPathName(Data.Node->GetJointManager()) != RelPath) continue;
+		return FoundIndex ? &(*TargetDataArrayPtr)[*FoundIndex] : nullptr;
+	}
 
-		OutDebugData = &Data;
+	return &Data;
+}
 
-		break;
+void UJointDebugger::BuildDebugDataIndexFor(const TArray<FJointNodeDebugData>& DebugDataArray, FDebugDataIndex& OutIndex)
+{
+	OutIndex.Data = DebugDataArray.GetData();
+	OutIndex.Num = DebugDataArray.Num();
+
+	OutIndex.Index.Reset();
+
+	for (int32 DataIndex = 0; DataIndex < DebugDataArray.Num(); ++DataIndex)
+	{
+		const FJointNodeDebugData& Data = DebugDataArray[DataIndex];
+
+		if (Data.Node == nullptr || Data.Node->GetCastedNodeInstance() == nullptr) continue;
+
+		//Keep the first one, same as the linear search did.
+		if (!OutIndex.Index.Contains(Data.Node->GetCastedNodeInstance()->GetNodeGuid()))
+		{
+			OutIndex.Index.Add(Data.Node->GetCastedNodeInstance()->GetNodeGuid(), DataIndex);
+		}
 	}
-	
-	return OutDebugData;
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -4,6 +4,7 @@
 #include "JointEdGraph.h"
 
 #include "JointManager.h"
+#include "Editor/Debug/JointDebugger.h"
 #include "GraphEditAction.h"
 #include "IMessageLogListing.h"
 #include "JointEdGraphSchema.h"
@@ -11,6 +12,7 @@
 #include "JointEditorStyle.h"
 #include "JointEditorToolkit.h"
 #include "JointEdUtils.h"
+#include "JointWiggleWireSimulator.h"
 #include "MessageLogModule.h"
 #include "EdGraph/EdGraphSchema.h"
 #include "Framework/Notifications/NotificationManager.h"
@@ -69,19 +71,37 @@ void UJointEdGraph::PostEditChangeProperty(FPropertyChangedEvent& PropertyChange
 
 void UJointEdGraph::NotifyGraphChanged()
 {
+	//It will be notified once when the bulk edit ends.
+	if (IsInBulkEdit())
+	{
+		bHasDeferredGraphChange = true;
+		return;
+	}
+
 	Super::NotifyGraphChanged();
 
 	RecacheNodes();
 
+	NotifyGraphHierarchyChanged();
+
 	UpdateGraph();
 	
 }
 
 void UJointEdGraph::NotifyGraphChanged(const FEdGraphEditAction& InAction)
 {
+	if (IsInBulkEdit())
+	{
+		bHasDeferredGraphChange = true;
+		return;
+	}
+
 	Super::NotifyGraphChanged(InAction);
 
-	RecacheNodes();
+	if (!UpdateNodeCachesForAction(InAction)) RecacheNodes();
+
+	//The composite nodes bring their sub graphs with them.
+	NotifyGraphHierarchyChanged();
 
 	UpdateGraph();
 }
@@ -102,6 +122,9 @@ void UJointEdGraph::UpdateGraph()
 		LockUpdates();
 
 		AllocateBaseNodesToJointManager();
+
+		//The debugger indexes the graph nodes for the session. Let it know the graph has been changed.
+		UJointDebugger::InvalidateDebugLookUpFor(GetJointManager());
 		
 		TryReinstancingUnknownNodeClasses();
 		
@@ -156,7 +179,10 @@ void UJointEdGraph::FeedToolkitToGraphNodes()
 
 void UJointEdGraph::NotifyNodeConnectionChanged()
 {
-	for (const TWeakObjectPtr<UJointEdGraphNode> GraphNode : GetCachedJointGraphNodes())
+	//Iterate a copy - the nodes can change the graph on the notification.
+	const TSet<TWeakObjectPtr<UJointEdGraphNode>> GraphNodes = GetCachedJointGraphNodes();
+
+	for (const TWeakObjectPtr<UJointEdGraphNode> GraphNode : GraphNodes)
 	{
 		if (GraphNode.IsValid()) GraphNode->NodeConnectionListChanged();
 	}
@@ -181,8 +207,9 @@ void UJointEdGraph::ReallocateGraphPanelToGraphNodeSlates(TSharedPtr<SGraphPanel
 
 void UJointEdGraph::RecacheNodes()
 {
-	CacheJointNodeInstances();
-	CacheJointGraphNodes();
+	//They will be rebuilt on the next access. Don't rebuild them for every change notification.
+	bJointNodeInstancesDirty = true;
+	bJointGraphNodesDirty = true;
 }
 
 void GetSubGraphsRecursively(UJointEdGraph* InGraph, TArray<UJointEdGraph*>& OutGraphs)
@@ -265,6 +292,8 @@ TArray<UJointEdGraph*> UJointEdGraph::GetAllGraphsFrom(UEdGraph* InGraph)
 
 	if (UJointEdGraph* CastedGraph = Cast<UJointEdGraph>(InGraph))
 	{
+		if (CastedGraph->IsRootGraph()) return CastedGraph->GetCachedGraphHierarchy();
+
 		OutGraphs.Add(CastedGraph);
 
 		OutGraphs.Append(CastedGraph->GetAllSubGraphsRecursively());
@@ -275,14 +304,49 @@ TArray<UJointEdGraph*> UJointEdGraph::GetAllGraphsFrom(UEdGraph* InGraph)
 
 TArray<UJointEdGraph*> UJointEdGraph::GetAllGraphsFrom(const UJointManager* InJointManager)
 {
-	TArray<UJointEdGraph*> OutGraphs;
+	return GetCachedGraphsFrom(InJointManager);
+}
 
-	if (InJointManager)
-	{
-		OutGraphs.Append(GetAllGraphsFrom(InJointManager->JointGraph));
-	}
+const TArray<UJointEdGraph*>& UJointEdGraph::GetCachedGraphsFrom(const UJointManager* InJointManager)
+{
+	static const TArray<UJointEdGraph*> EmptyGraphs;
 
-	return OutGraphs;
+	if (InJointManager == nullptr) return EmptyGraphs;
+
+	UJointEdGraph* CastedGraph = Cast<UJointEdGraph>(InJointManager->JointGraph);
+
+	if (CastedGraph == nullptr) return EmptyGraphs;
+
+	return CastedGraph->GetCachedGraphHierarchy();
+}
+
+const TArray<UJointEdGraph*>& UJointEdGraph::GetCachedGraphHierarchy()
+{
+	UJointEdGraph* RootGraph = GetRootGraph();
+
+	if (RootGraph != this) return RootGraph->GetCachedGraphHierarchy();
+
+	if (bGraphHierarchyDirty) CacheGraphHierarchy();
+
+	return CachedGraphHierarchy;
+}
+
+void UJointEdGraph::CacheGraphHierarchy()
+{
+	CachedGraphHierarchy.Reset();
+
+	CachedGraphHierarchy.Add(this);
+
+	GetSubGraphsRecursively(this, CachedGraphHierarchy);
+
+	bGraphHierarchyDirty = false;
+}
+
+void UJointEdGraph::NotifyGraphHierarchyChanged()
+{
+	bGraphHierarchyDirty = true;
+
+	GetRootGraph()->bGraphHierarchyDirty = true;
 }
 
 void UJointEdGraph::SetToolkit(const TSharedPtr<FJointEditorToolkit>& InToolkit)
@@ -322,6 +386,8 @@ void UJointEdGraph::OnSave()
 void UJointEdGraph::OnClosed()
 {
 	CleanUpNodes();
+
+	FJointWiggleWirePool::Release(GraphGuid);
 }
 
 void UJointEdGraph::BindEdNodeEvents()
@@ -576,7 +642,8 @@ void UJointEdGraph::PatchNodePickers()
 
 void UJointEdGraph::ExecuteForAllNodesInHierarchy(const TFunction<void(UEdGraphNode*)>& Func)
 {
-	const TSet<TWeakObjectPtr<UJointEdGraphNode>>& CachedNodes = GetCachedJointGraphNodes();
+	//Iterate a copy - the function can change the graph.
+	const TSet<TWeakObjectPtr<UJointEdGraphNode>> CachedNodes = GetCachedJointGraphNodes();
 
 	for (TWeakObjectPtr<UJointEdGraphNode> JointEdGraphNode : CachedNodes)
 	{
@@ -620,11 +687,11 @@ void UJointEdGraph::InitializeCompileResultIfNeeded()
 	}
 }
 
-void UJointEdGraph::CompileAllJointGraphFromRoot()
+void UJointEdGraph::CompileAllJointGraphFromRoot(const bool bForceCompileAll)
 {
 	if (GetRootGraph() != this)
 	{
-		GetRootGraph()->CompileAllJointGraphFromRoot();
+		GetRootGraph()->CompileAllJointGraphFromRoot(bForceCompileAll);
 		return;
 	}
 
@@ -632,38 +699,73 @@ void UJointEdGraph::CompileAllJointGraphFromRoot()
 
 	const double CompileStartTime = FPlatformTime::Seconds();
 
+	//The node classes (and their blueprints) might have been changed since the last compilation.
+	UJointEdGraphNode::ResetNodeClassContentHashCache();
+
+	bool bAllNodesUpToDate = false;
+
+	//The reachability can only change with the connections or the sub nodes of the nodes, which change their content hashes as well. Don't walk the graph for it until something has to be compiled.
+	const uint32 GraphContentHash = CalculateGraphCompileContentHash(bAllNodesUpToDate);
+
+	//Nothing has been changed since the last compilation (e.g. the cook for the other platforms, or a save without any change). The compile result log is still valid.
+	if (!bForceCompileAll && bAllNodesUpToDate && LastCompiledGraphContentHash != 0 && LastCompiledGraphContentHash == GraphContentHash)
+	{
+		if (OnCompileFinished.IsBound())
+			OnCompileFinished.Execute(
+				UJointEdGraph::FJointGraphCompileInfo(GetCachedJointGraphNodes().Num(), (FPlatformTime::Seconds() - CompileStartTime), 0));
+
+		return;
+	}
+
 	CompileResultPtr->ClearMessages();
 
-	CompileJointGraph();
+	//The nodes read the reachability of the graph on their compile.
+	if (JointManager) JointManager->UpdateReachability();
 
-	for (UJointEdGraph* SubGraph : GetAllSubGraphsRecursively())
+	int32 CompiledNodeCount = 0;
+
+	for (UJointEdGraph* Graph : GetCachedGraphHierarchy())
 	{
-		SubGraph->CompileJointGraph();
+		if (Graph == nullptr) continue;
+
+		Graph->CompileJointGraph(bForceCompileAll, CompiledNodeCount);
 	}
 
+	//Compiling the nodes doesn't change their content, but take the hash again to make sure the next compilation compares against the actual result.
+	LastCompiledGraphContentHash = CalculateGraphCompileContentHash(bAllNodesUpToDate);
+
 	const double CompileEndTime = FPlatformTime::Seconds();
 
 	if (OnCompileFinished.IsBound())
 		OnCompileFinished.Execute(
-			UJointEdGraph::FJointGraphCompileInfo(GetCachedJointGraphNodes().Num(), (CompileEndTime - CompileStartTime)));
+			UJointEdGraph::FJointGraphCompileInfo(GetCachedJointGraphNodes().Num(), (CompileEndTime - CompileStartTime), CompiledNodeCount));
 }
 
-void UJointEdGraph::CompileJointGraphForNode(UJointEdGraphNode* Node, const bool bPropagateToSubNodes)
+void UJointEdGraph::CompileJointGraphForNode(UJointEdGraphNode* Node, const bool bPropagateToSubNodes, const bool bForceCompile, int32& OutCompiledNodeCount)
 {
 	if (Node == nullptr) return;
 
 	//Abort if the CompileResultPtr was not valid.
 	if (!CompileResultPtr.IsValid()) return;
 
-	Node->CompileNode(CompileResultPtr.ToSharedRef());
+	if (bForceCompile || !Node->IsCompileResultUpToDate())
+	{
+		Node->CompileNode(CompileResultPtr.ToSharedRef());
+
+		++OutCompiledNodeCount;
+	}
+	else
+	{
+		Node->RestoreCompileResult(CompileResultPtr.ToSharedRef());
+	}
 
 	if (bPropagateToSubNodes)
 	{
-		for (UJointEdGraphNode* SubNode : Node->SubNodes) CompileJointGraphForNode(SubNode, bPropagateToSubNodes);
+		for (UJointEdGraphNode* SubNode : Node->SubNodes) CompileJointGraphForNode(SubNode, bPropagateToSubNodes, bForceCompile, OutCompiledNodeCount);
 	}
 }
 
-void UJointEdGraph::CompileJointGraph()
+void UJointEdGraph::CompileJointGraph(const bool bForceCompile, int32& OutCompiledNodeCount)
 {
 	InitializeCompileResultIfNeeded();
 
@@ -676,8 +778,32 @@ void UJointEdGraph::CompileJointGraph()
 
 		UJointEdGraphNode* CastedNode = Cast<UJointEdGraphNode>(EdGraphNode);
 
-		CompileJointGraphForNode(CastedNode, true);
+		CompileJointGraphForNode(CastedNode, true, bForceCompile, OutCompiledNodeCount);
+	}
+}
+
+uint32 UJointEdGraph::CalculateGraphCompileContentHash(bool& bOutAllNodesUpToDate)
+{
+	bOutAllNodesUpToDate = true;
+
+	uint32 Hash = 0;
+
+	for (UJointEdGraph* Graph : GetCachedGraphHierarchy())
+	{
+		if (Graph == nullptr) continue;
+
+		for (const TWeakObjectPtr<UJointEdGraphNode>& GraphNode : Graph->GetCachedJointGraphNodes())
+		{
+			if (!GraphNode.IsValid()) continue;
+
+			if (!GraphNode->IsCompileResultUpToDate()) bOutAllNodesUpToDate = false;
+
+			//Summed up, since the order of the cached nodes is not stable.
+			Hash += HashCombine(GetTypeHash(GraphNode->NodeGuid), GraphNode->GetCompileContentHash());
+		}
 	}
+
+	return Hash;
 }
 
 void UJointEdGraph::UpdateSubNodeChains()
@@ -698,9 +824,7 @@ UEdGraphNode* UJointEdGraph::FindGraphNodeForNodeInstance(const UObject* NodeIns
 {
 	if (NodeInstance == nullptr) return nullptr;
 
-	CacheJointGraphNodes();
-
-	for (TWeakObjectPtr<UJointEdGraphNode> CachedJointGraphNode : CachedJointGraphNodes)
+	for (const TWeakObjectPtr<UJointEdGraphNode>& CachedJointGraphNode : GetCachedJointGraphNodes())
 	{
 		if (CachedJointGraphNode == nullptr) continue;
 
@@ -710,16 +834,16 @@ UEdGraphNode* UJointEdGraph::FindGraphNodeForNodeInstance(const UObject* NodeIns
 	return nullptr;
 }
 
-TSet<TWeakObjectPtr<UObject>> UJointEdGraph::GetCachedJointNodeInstances(const bool bForceRecache)
+const TSet<TWeakObjectPtr<UObject>>& UJointEdGraph::GetCachedJointNodeInstances(const bool bForceRecache)
 {
-	if (bForceRecache || CachedJointNodeInstances.IsEmpty()) CacheJointNodeInstances();
+	if (bForceRecache || bJointNodeInstancesDirty) CacheJointNodeInstances();
 
 	return CachedJointNodeInstances;
 }
 
-TSet<TWeakObjectPtr<UJointEdGraphNode>> UJointEdGraph::GetCachedJointGraphNodes(const bool bForceRecache)
+const TSet<TWeakObjectPtr<UJointEdGraphNode>>& UJointEdGraph::GetCachedJointGraphNodes(const bool bForceRecache)
 {
-	if (bForceRecache || CachedJointGraphNodes.IsEmpty()) CacheJointGraphNodes();
+	if (bForceRecache || bJointGraphNodesDirty) CacheJointGraphNodes();
 
 	return CachedJointGraphNodes;
 }
@@ -729,7 +853,8 @@ void UJointEdGraph::BeginCacheForCookedPlatformData(const ITargetPlatform* Targe
 {
 	if (GetRootGraph() == this)
 	{
-		CompileAllJointGraphFromRoot();
+		//The compile results saved with the asset can be stale for the cook (e.g. the node classes have been changed after the last save), so the first compilation of the session checks every node.
+		CompileAllJointGraphFromRoot(LastCompiledGraphContentHash == 0);
 	}
 
 	Super::BeginCacheForCookedPlatformData(TargetPlatform);
@@ -779,12 +904,14 @@ void UJointEdGraph::CacheJointNodeInstances()
 {
 	FScopeLock Lock(&CachedJointNodeInstancesMutex);
 
-	CachedJointNodeInstances.Empty();
+	CachedJointNodeInstances.Reset();
 
 	for (const TObjectPtr<UEdGraphNode> EdGraphNode : Nodes)
 	{
 		CollectInstances(CachedJointNodeInstances, EdGraphNode);
 	}
+
+	bJointNodeInstancesDirty = false;
 }
 
 void CollectAllGraphNodesInternal(TSet<TWeakObjectPtr<UJointEdGraphNode>>& GraphNodes, TObjectPtr<UEdGraphNode> Node)
@@ -807,12 +934,52 @@ void UJointEdGraph::CacheJointGraphNodes()
 {
 	FScopeLock Lock(&CachedJointGraphNodesMutex);
 
-	CachedJointGraphNodes.Empty();
+	CachedJointGraphNodes.Reset();
 
 	for (const TObjectPtr<UEdGraphNode> EdGraphNode : Nodes)
 	{
 		CollectAllGraphNodesInternal(CachedJointGraphNodes, EdGraphNode);
 	}
+
+	bJointGraphNodesDirty = false;
+}
+
+bool UJointEdGraph::UpdateNodeCachesForAction(const FEdGraphEditAction& InAction)
+{
+	//Nothing to patch up if the caches will be rebuilt anyway.
+	if (bJointNodeInstancesDirty || bJointGraphNodesDirty) return false;
+
+	const bool bAdded = (InAction.Action & GRAPHACTION_AddNode) != 0;
+	const bool bRemoved = (InAction.Action & GRAPHACTION_RemoveNode) != 0;
+
+	//Only the pure additions & removals can be applied. The selection doesn't change anything.
+	if (bAdded == bRemoved || (InAction.Action & ~(GRAPHACTION_AddNode | GRAPHACTION_RemoveNode | GRAPHACTION_SelectNode)) != 0) return false;
+
+	FScopeLock InstancesLock(&CachedJointNodeInstancesMutex);
+	FScopeLock GraphNodesLock(&CachedJointGraphNodesMutex);
+
+	TSet<TWeakObjectPtr<UObject>> ChangedInstances;
+	TSet<TWeakObjectPtr<UJointEdGraphNode>> ChangedGraphNodes;
+
+	for (const UEdGraphNode* ChangedNode : InAction.Nodes)
+	{
+		//Sub nodes are collected with their parent nodes.
+		CollectInstances(ChangedInstances, const_cast<UEdGraphNode*>(ChangedNode));
+		CollectAllGraphNodesInternal(ChangedGraphNodes, const_cast<UEdGraphNode*>(ChangedNode));
+	}
+
+	if (bAdded)
+	{
+		CachedJointNodeInstances.Append(ChangedInstances);
+		CachedJointGraphNodes.Append(ChangedGraphNodes);
+	}
+	else
+	{
+		for (const TWeakObjectPtr<UObject>& ChangedInstance : ChangedInstances) CachedJointNodeInstances.Remove(ChangedInstance);
+		for (const TWeakObjectPtr<UJointEdGraphNode>& ChangedGraphNode : ChangedGraphNodes) CachedJointGraphNodes.Remove(ChangedGraphNode);
+	}
+
+	return true;
 }
 
 
@@ -915,4 +1082,26 @@ void UJointEdGraph::UnlockUpdates()
 	bIsLocked = false;
 }
 
+void UJointEdGraph::BeginBulkEdit()
+{
+	++BulkEditDepth;
+}
+
+void UJointEdGraph::EndBulkEdit()
+{
+	if (!ensure(BulkEditDepth > 0)) return;
+
+	if (--BulkEditDepth > 0 || !bHasDeferredGraphChange) return;
+
+	bHasDeferredGraphChange = false;
+
+	//The actions made during the bulk edit are not known anymore, so let everything be rebuilt at once.
+	NotifyGraphChanged();
+}
+
+bool UJointEdGraph::IsInBulkEdit() const
+{
+	return BulkEditDepth > 0;
+}
+
 #undef LOCTEXT_NAMESPACE
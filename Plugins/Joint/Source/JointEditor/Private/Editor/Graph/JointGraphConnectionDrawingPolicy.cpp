@@ -14,12 +14,6 @@
 #include "Misc/EngineVersionComparison.h"
 
 
-namespace JointWiggleWireGlobals
-{
-	TMap<FGuid, TMap<FGraphWireId, TSharedPtr<FWiggleWireSimulator>>> GraphWireSimulators;
-}
-
-
 FJointGraphConnectionDrawingPolicy::FJointGraphConnectionDrawingPolicy(int32 InBackLayerID, int32 InFrontLayerID,
                                                                        float ZoomFactor,
                                                                        const FSlateRect& InClippingRect,
@@ -28,8 +22,7 @@ FJointGraphConnectionDrawingPolicy::FJointGraphConnectionDrawingPolicy(int32 InB
 	: FConnectionDrawingPolicy(InBackLayerID, InFrontLayerID, ZoomFactor, InClippingRect, InDrawElements),
 	  GraphObj(InGraphObj),
 
-	  WireSimulators(JointWiggleWireGlobals::GraphWireSimulators.FindOrAdd(InGraphObj->GraphGuid)),
-	  TimeSinceLastPrune(0.0f),
+	  WirePool(FJointWiggleWirePool::FindOrAdd(InGraphObj->GraphGuid)),
 
 	  bUseWiggleWireForNormalConnection(UJointEditorSettings::Get()->bUseWiggleWireForNormalConnection),
 	  bUseWiggleWireForRecursiveConnection(
@@ -403,6 +396,9 @@ void FJointGraphConnectionDrawingPolicy::Draw(TMap<TSharedRef<SWidget>, FArrange
 		NodeWidgetMap.Add(ChildNode->GetNodeObj(), NodeIndex);
 	}
 
+	// Advance the wiggle wires with the endpoints they have been drawn with on the last frame, before they are drawn again
+	WirePool.Step(UJointEditorSettings::Get()->WiggleWireSimulationTimeBudget * 0.001);
+
 	// Now draw
 	FConnectionDrawingPolicy::Draw(InPinGeometries, ArrangedNodes);
 }
@@ -595,114 +591,14 @@ FVector2D FJointGraphConnectionDrawingPolicy::ComputeJointSplineTangent(const FV
 	return ComputeStraightLineTangent(Start, End);
 }
 
-TSharedPtr<FWiggleWireSimulator> FJointGraphConnectionDrawingPolicy::GetOrAddSimulator(const FGraphWireId& Id)
-{
-	/*
-	if(WireSimulators.Contains(Id))
-	{
-		return WireSimulators[Id];
-	}
-	
-	TSharedPtr<FWiggleWireSimulator> SimulatorPtrRef = FWiggleWireSimulator::MakeInstance();
-	
-	if (!SimulatorPtrRef.IsValid())
-	{
-		SimulatorPtrRef = FWiggleWireSimulator::MakeInstance();
-
-		WireSimulators.Add(Id, SimulatorPtrRef);
-
-		UE_LOG(LogJointEditor,Log,TEXT("New Connection for %s"), *FString::FromInt(GetTypeHash(Id)));
-	}
-	
-	return SimulatorPtrRef;
-	*/
-
-	TSharedPtr<FWiggleWireSimulator>& SimulatorPtrRef = WireSimulators.FindOrAdd(Id);
-
-	if (!SimulatorPtrRef.IsValid())
-	{
-		SimulatorPtrRef = FWiggleWireSimulator::MakeInstance();
-	}
-
-	return SimulatorPtrRef;
-}
-
-void FJointGraphConnectionDrawingPolicy::PruneDeadSimulators(const float DeltaTime)
-{
-	TimeSinceLastPrune += DeltaTime;
-	if (TimeSinceLastPrune < PRUNE_INTERVAL)
-	{
-		return; // Only prune periodically
-	}
-	TimeSinceLastPrune = 0.0f;
-
-	TArray<FGraphWireId> SimulatorsToRemove;
-	SimulatorsToRemove.Reserve(WireSimulators.Num()); // Avoid reallocations
-	for (auto It = WireSimulators.CreateConstIterator(); It; ++It)
-	{
-		const FGraphWireId& WireId = It.Key();
-		const UEdGraphPin* Pin1 = WireId.StartPin;
-		const UEdGraphPin* Pin2 = WireId.EndPin;
-
-		bool bConnectionIsValid = false;
-		if (Pin1 && Pin2)
-		{
-			// Basic check: are the pins still linked?
-			if (Pin1->LinkedTo.Contains(Pin2))
-			{
-				// @note: Maybe a stricter check here? Do pins still belong to *this* graph? Uncomment if needed
-				// (In cases if pins/nodes could somehow be moved between graphs?)
-				// UEdGraph* Pin1Graph = Pin1->GetOwningNodeUnchecked() ? Pin1->GetOwningNode()->GetGraph() : nullptr;
-				// UEdGraph* Pin2Graph = Pin2->GetOwningNodeUnchecked() ? Pin2->GetOwningNode()->GetGraph() : nullptr;
-				// if (Pin1Graph == GraphObj && Pin2Graph == GraphObj)
-				// {
-				bConnectionIsValid = true;
-				// }
-			}
-		}
-
-		if (!bConnectionIsValid)
-		{
-			SimulatorsToRemove.Add(WireId);
-		}
-	}
-
-	// Remove the dead simulators from the map
-	if (SimulatorsToRemove.Num() > 0)
-	{
-		for (const FGraphWireId& IdToRemove : SimulatorsToRemove)
-		{
-			WireSimulators.Remove(IdToRemove);
-		}
-		const int32 RemovedCount = SimulatorsToRemove.Num();
-		UE_LOG(LogJointEditor, Log, TEXT("Pruned %d dead wire simulators."), RemovedCount);
-	}
-}
-
 void FJointGraphConnectionDrawingPolicy::DrawWiggleConnection(int32 LayerId, const FVector2D& Start,
                                                               const FVector2D& End, const FConnectionParams& Params,
                                                               const FWiggleWireConfig& Config)
 {
-	const FGraphWireId WireId(Params.AssociatedPin1, Params.AssociatedPin2);
-	TSharedPtr<FWiggleWireSimulator> Simulator = GetOrAddSimulator(WireId);
-	if (!Simulator.IsValid())
-	{
-		UE_LOG(LogJointEditor, Error, TEXT("DrawWiggleConnection: Failed to get or add simulator for wire ID!"));
-
-		// Fallback draw
-		DrawTangentConnection(LayerId, Start, End, Params);
-
-		return;
-	}
-
-	// Get DeltaTime
-	const float DeltaTime = FSlateApplication::Get().GetDeltaTime();
-
-	// Update the simulation state (but don't use the return value directly as a point!)
-	Simulator->Update(Start, End, Config, DeltaTime);
+	// Record the endpoints for the batched pass, and read back the current state of the simulation
+	const FWiggleWireSimulator& Simulator = WirePool.Touch(FGraphWireId(Params.AssociatedPin1, Params.AssociatedPin2), Start, End, Config);
 
-	// Now get the actual visual center point
-	const FVector2D CenterPoint = Simulator->GetVisualCenter(Start, End);
+	const FVector2D CenterPoint = Simulator.GetVisualCenter(Start, End);
 
 	// Calculate tangents based on the simulated center point and configured TangentFactor
 	const FVector2D P0Tangent = (CenterPoint - Start) * Config.TangentFactor;
@@ -830,12 +726,7 @@ void FJointGraphConnectionDrawingPolicy::DrawWiggleConnection(int32 LayerId, con
 
 void FJointGraphConnectionDrawingPolicy::NotifyViewChanged() const
 {
-	// Iterate through all active simulators and activate them
+	// Wake up all the simulators of the graph
 
-	for (const TTuple<FGraphWireId, TSharedPtr<FWiggleWireSimulator>>& WireSimulator : WireSimulators)
-	{
-		if (!WireSimulator.Value.IsValid()) continue;
-
-		WireSimulator.Value.Get()->Activate();
-	}
+	WirePool.ActivateAll();
 }
@@ -2,6 +2,15 @@
 
 #include "JointWiggleWireSimulator.h"
 
+#include "HAL/PlatformTime.h"
+
+
+namespace JointWiggleWireGlobals
+{
+	/** The pools are held by pointer so the references handed out stay valid while the map grows. */
+	TMap<FGuid, TUniquePtr<FJointWiggleWirePool>> GraphWirePools;
+}
+
 
 FWiggleWireSimulator::FWiggleWireSimulator()
     : CurrentVisualOffset(FVector2D::ZeroVector)
@@ -102,6 +111,22 @@ bool FWiggleWireSimulator::IsActive() const
     return bIsActive;
 }
 
+void FWiggleWireSimulator::Settle(const FVector2D& StartPoint, const FVector2D& EndPoint, const FWiggleWireConfig& Config)
+{
+    TargetVisualOffset = CalculateTargetOffset(StartPoint, EndPoint, Config);
+    CurrentVisualOffset = TargetVisualOffset;
+    Velocity = FVector2D::ZeroVector;
+    LastEndpointVelocity = FVector2D::ZeroVector;
+    LastStartPoint = StartPoint;
+    LastEndPoint = EndPoint;
+    bIsActive = false;
+}
+
+bool FWiggleWireSimulator::HasEndpointsMoved(const FVector2D& StartPoint, const FVector2D& EndPoint) const
+{
+    return !StartPoint.Equals(LastStartPoint, POSITION_CHANGE_THRESHOLD) || !EndPoint.Equals(LastEndPoint, POSITION_CHANGE_THRESHOLD);
+}
+
 TSharedPtr<FWiggleWireSimulator> FWiggleWireSimulator::MakeInstance()
 {
     //return MakeShareable(new FWiggleWireSimulator());
@@ -224,3 +249,150 @@ float FWiggleWireSimulator::CalculateAdaptiveDamping(const FWiggleWireConfig& Co
     return AdaptiveDamping;
 }
 
+
+const FWiggleWireSimulator& FJointWiggleWirePool::Touch(const FGraphWireId& Id, const FVector2D& StartPoint, const FVector2D& EndPoint, const FWiggleWireConfig& Config)
+{
+	const double CurrentTime = FApp::GetCurrentTime();
+
+	int32 Index;
+
+	if (const int32* FoundIndex = IndexMap.Find(Id))
+	{
+		Index = *FoundIndex;
+	}
+	else
+	{
+		Index = Simulators.AddDefaulted();
+		Entries.Emplace(Id);
+		IndexMap.Add(Id, Index);
+
+		Simulators[Index].Settle(StartPoint, EndPoint, Config);
+		Entries[Index].LastStepTime = CurrentTime;
+	}
+
+	FWireEntry& Entry = Entries[Index];
+
+	Entry.StartPoint = StartPoint;
+	Entry.EndPoint = EndPoint;
+	Entry.Config = Config;
+	Entry.LastDrawnFrame = GFrameCounter;
+	Entry.LastDrawnTime = CurrentTime;
+
+	FWiggleWireSimulator& Simulator = Simulators[Index];
+
+	if (!Simulator.IsActive() && Simulator.HasEndpointsMoved(StartPoint, EndPoint))
+	{
+		//The time it has slept doesn't count.
+		Entry.LastStepTime = CurrentTime - FApp::GetDeltaTime();
+
+		Simulator.Activate();
+	}
+
+	return Simulator;
+}
+
+void FJointWiggleWirePool::Step(const double BudgetSeconds)
+{
+	if (LastSteppedFrame == GFrameCounter) return;
+
+	LastSteppedFrame = GFrameCounter;
+
+	const double CurrentTime = FApp::GetCurrentTime();
+
+	if (CurrentTime - LastEvictionTime > EVICTION_INTERVAL)
+	{
+		LastEvictionTime = CurrentTime;
+
+		EvictStaleWires(CurrentTime);
+	}
+
+	const int32 NumWires = Simulators.Num();
+
+	if (NumWires == 0) return;
+
+	if (StepCursor >= NumWires) StepCursor = 0;
+
+	const double PassStartTime = FPlatformTime::Seconds();
+
+	for (int32 Count = 0; Count < NumWires; ++Count)
+	{
+		const int32 Index = (StepCursor + Count) % NumWires;
+
+		FWiggleWireSimulator& Simulator = Simulators[Index];
+		FWireEntry& Entry = Entries[Index];
+
+		//Sleep while it is at rest, or while it is not drawn. It will be woken up by Touch() once it is moved on the screen again.
+		if (!Simulator.IsActive() || Entry.LastDrawnFrame + 1 < GFrameCounter) continue;
+
+		Simulator.Update(Entry.StartPoint, Entry.EndPoint, Entry.Config, static_cast<float>(CurrentTime - Entry.LastStepTime));
+
+		Entry.LastStepTime = CurrentTime;
+
+		if ((Count + 1) % BUDGET_CHECK_INTERVAL == 0 && FPlatformTime::Seconds() - PassStartTime > BudgetSeconds)
+		{
+			StepCursor = (Index + 1) % NumWires;
+
+			return;
+		}
+	}
+}
+
+void FJointWiggleWirePool::ActivateAll()
+{
+	for (FWiggleWireSimulator& Simulator : Simulators)
+	{
+		Simulator.Activate();
+	}
+}
+
+int32 FJointWiggleWirePool::Num() const
+{
+	return Simulators.Num();
+}
+
+int32 FJointWiggleWirePool::NumAwake() const
+{
+	int32 NumAwake = 0;
+
+	for (const FWiggleWireSimulator& Simulator : Simulators)
+	{
+		if (Simulator.IsActive()) ++NumAwake;
+	}
+
+	return NumAwake;
+}
+
+FJointWiggleWirePool& FJointWiggleWirePool::FindOrAdd(const FGuid& GraphGuid)
+{
+	TUniquePtr<FJointWiggleWirePool>& Pool = JointWiggleWireGlobals::GraphWirePools.FindOrAdd(GraphGuid);
+
+	if (!Pool.IsValid()) Pool = MakeUnique<FJointWiggleWirePool>();
+
+	return *Pool;
+}
+
+void FJointWiggleWirePool::Release(const FGuid& GraphGuid)
+{
+	JointWiggleWireGlobals::GraphWirePools.Remove(GraphGuid);
+}
+
+void FJointWiggleWirePool::EvictStaleWires(const double CurrentTime)
+{
+	//The wires of the removed connections are never drawn again, so they are evicted here as well - without touching their pins that might have been freed already.
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		if (CurrentTime - Entries[Index].LastDrawnTime > EVICTION_AGE) RemoveAtSwap(Index);
+	}
+}
+
+void FJointWiggleWirePool::RemoveAtSwap(const int32 Index)
+{
+	const int32 LastIndex = Entries.Num() - 1;
+
+	IndexMap.Remove(Entries[Index].Id);
+
+	if (Index != LastIndex) IndexMap.Add(Entries[LastIndex].Id, Index);
+
+	Simulators.RemoveAtSwap(Index);
+	Entries.RemoveAtSwap(Index);
+}
@@ -26,6 +26,9 @@
 #include "Node/JointFragment.h"
 #include "Node/JointNodeBase.h"
 #include "Serialization/TextReferenceCollector.h"
+#include "SharedType/JointAssetRegistryTags.h"
+#include "SharedType/JointSharedTypes.h"
+#include "UObject/UnrealType.h"
 
 #include "Misc/EngineVersionComparison.h"
 
@@ -313,25 +316,19 @@ UJointEdGraph* FJointEdUtils::FindGraphForNodeInstance(const UJointNodeBase* Nod
 
 		if (UJointEdGraph* CastedGraph = Cast<UJointEdGraph>(Manager->JointGraph))
 		{
-			TSet<TWeakObjectPtr<UObject>> Nodes = CastedGraph->GetCachedJointNodeInstances(false);
-
 			// do const_cast here - due to TSet not supporting const types in older UE versions
-			if (Nodes.Contains(const_cast<UJointNodeBase*>(NodeInstance)))
+			if (CastedGraph->GetCachedJointNodeInstances().Contains(const_cast<UJointNodeBase*>(NodeInstance)))
 			{
 				return CastedGraph;
 			}
 
 			//if not found, search in sub graphs
-			TArray<UJointEdGraph*> Graphs = CastedGraph->GetAllSubGraphsRecursively();
-			
-			for (UJointEdGraph* Graph : Graphs)
+			for (UJointEdGraph* Graph : CastedGraph->GetCachedGraphHierarchy())
 			{
-				if (Graph == nullptr) continue;
-
-				Nodes = Graph->GetCachedJointNodeInstances(false);
+				if (Graph == nullptr || Graph == CastedGraph) continue;
 
 				// do const_cast here - due to TSet not supporting const types in older UE versions
-				if (Nodes.Contains(const_cast<UJointNodeBase*>(NodeInstance)))
+				if (Graph->GetCachedJointNodeInstances().Contains(const_cast<UJointNodeBase*>(NodeInstance)))
 				{
 					return Graph;
 				}
@@ -387,15 +384,11 @@ UJointEdGraphNode* FJointEdUtils::FindGraphNodeWithProvidedNodeInstanceGuid(UJoi
 {
 	if (JointManager == nullptr) return nullptr;
 
-	TArray<UJointEdGraph*> AllGraphs = UJointEdGraph::GetAllGraphsFrom(JointManager);
-
-	for (UJointEdGraph* Graph : AllGraphs)
+	for (UJointEdGraph* Graph : UJointEdGraph::GetCachedGraphsFrom(JointManager))
 	{
 		if (Graph == nullptr) continue;
 
-		TSet<TWeakObjectPtr<UJointEdGraphNode>> GraphNodes = Graph->GetCachedJointGraphNodes();
-
-		for (TWeakObjectPtr<UJointEdGraphNode> GraphNode : GraphNodes)
+		for (const TWeakObjectPtr<UJointEdGraphNode>& GraphNode : Graph->GetCachedJointGraphNodes())
 		{
 			if (GraphNode == nullptr) continue;
 
@@ -552,6 +545,11 @@ void FJointEdUtils::MarkNodesAsModifiedAndValidateName(
 	}
 
 	// rename the node instances to avoid name conflicts
+	ValidateNameOfPastedNodes(InNodes);
+}
+
+void FJointEdUtils::ValidateNameOfPastedNodes(const TSet<UEdGraphNode*>& InNodes)
+{
 	for (UEdGraphNode* NewPastedGraphNode : InNodes)
 	{
 		if (UJointEdGraphNode* CastedGraphNode = Cast<UJointEdGraphNode>(NewPastedGraphNode))
@@ -571,7 +569,68 @@ void FJointEdUtils::MarkNodesAsModifiedAndValidateName(
 			}
 		}
 	}
-	
+}
+
+void FJointEdUtils::RemapNodePointersOfPastedNodes(const TSet<UEdGraphNode*>& InNodes)
+{
+	// collect every pasted node including the sub nodes, by the guid of the node they have been copied from
+	TMap<FGuid, UJointEdGraphNode*> PastedNodesByCopiedGuid;
+	TSet<UJointEdGraphNode*> PastedNodes;
+
+	auto CollectPastedNode = [&PastedNodesByCopiedGuid, &PastedNodes](UJointEdGraphNode* Node)
+	{
+		if (Node == nullptr || PastedNodes.Contains(Node)) return;
+
+		PastedNodes.Add(Node);
+
+		if (Node->GetCopiedNodeInstanceGuid().IsValid()) PastedNodesByCopiedGuid.Add(Node->GetCopiedNodeInstanceGuid(), Node);
+	};
+
+	for (UEdGraphNode* InNode : InNodes)
+	{
+		UJointEdGraphNode* CastedNode = Cast<UJointEdGraphNode>(InNode);
+
+		if (CastedNode == nullptr) continue;
+
+		CollectPastedNode(CastedNode);
+
+		for (UJointEdGraphNode* SubNode : CastedNode->GetAllSubNodesInHierarchy())
+		{
+			CollectPastedNode(SubNode);
+		}
+	}
+
+	if (PastedNodesByCopiedGuid.Num() == 0) return;
+
+	const UScriptStruct* NodePointerStruct = FJointNodePointer::StaticStruct();
+
+	// one pass over the pointers of each pasted node instance
+	for (UJointEdGraphNode* PastedNode : PastedNodes)
+	{
+		UJointNodeBase* NodeInstance = PastedNode->GetCastedNodeInstance();
+
+		if (NodeInstance == nullptr) continue;
+
+		for (TPropertyValueIterator<FStructProperty> It(NodeInstance->GetClass(), NodeInstance); It; ++It)
+		{
+			if (It.Key()->Struct != NodePointerStruct) continue;
+
+			It.SkipRecursiveProperty();
+
+			FJointNodePointer* Pointer = static_cast<FJointNodePointer*>(const_cast<void*>(It.Value()));
+
+			//Only the nodes in memory can be the originals of the pasted nodes, so there is no need to load anything here.
+			const UJointNodeBase* PointedNode = Pointer->Node.Get();
+
+			if (PointedNode == nullptr) continue;
+
+			if (UJointEdGraphNode* const* RemappedNode = PastedNodesByCopiedGuid.Find(PointedNode->NodeGuid))
+			{
+				Pointer->Node = (*RemappedNode)->GetCastedNodeInstance();
+				Pointer->EditorNode = *RemappedNode;
+			}
+		}
+	}
 }
 
 
@@ -726,10 +785,64 @@ EMessageSeverity::Type FJointEdUtils::ResolveJointEdMessageSeverityToEMessageSev
 	return EMessageSeverity::Info;
 }
 
+EJointEdMessageSeverity::Type FJointEdUtils::ResolveEMessageSeverityToJointEdMessageSeverity(
+	const EMessageSeverity::Type MessageSeverity)
+{
+	switch (MessageSeverity)
+	{
+	case EMessageSeverity::Warning:
+		return EJointEdMessageSeverity::Warning;
+	case EMessageSeverity::PerformanceWarning:
+		return EJointEdMessageSeverity::PerformanceWarning;
+	case EMessageSeverity::Error:
+		return EJointEdMessageSeverity::Error;
+	default:
+		return EJointEdMessageSeverity::Info;
+	}
+}
+
 
 
 
 
+void FJointEdUtils::GatherEditorAssetRegistryTags(const UJointManager* Manager, TArray<UObject::FAssetRegistryTag>& OutTags)
+{
+	if (Manager == nullptr) return;
+
+	TSet<FString> EditorNodeClassPaths;
+	TSet<FString> NodeClassPackageNames;
+	TSet<FString> NativeNodeClassNames;
+
+	for (UJointEdGraph* Graph : UJointEdGraph::GetCachedGraphsFrom(Manager))
+	{
+		if (!Graph) continue;
+
+		for (const TWeakObjectPtr<UJointEdGraphNode>& GraphNode : Graph->GetCachedJointGraphNodes())
+		{
+			if (!GraphNode.IsValid()) continue;
+
+			EditorNodeClassPaths.Add(GraphNode->GetClass()->GetPathName());
+
+			//Use the class data rather than the node instance, so the packages of the missing classes are recorded as well.
+			if (GraphNode->NodeClassData.IsBlueprint())
+			{
+				NodeClassPackageNames.Add(GraphNode->NodeClassData.GetPackageName());
+			}
+			else if (!GraphNode->NodeClassData.GetClassName().IsEmpty())
+			{
+				//The native classes have no package of their own to check. Record the path, or the name only if the class is missing already.
+				NativeNodeClassNames.Add(GraphNode->NodeClassData.Class.IsValid()
+					? GraphNode->NodeClassData.Class->GetPathName()
+					: GraphNode->NodeClassData.GetClassName());
+			}
+		}
+	}
+
+	OutTags.Add(UObject::FAssetRegistryTag(FJointAssetRegistryTags::EditorNodeClasses, FJointAssetRegistryTags::MakeList(EditorNodeClassPaths.Array()), UObject::FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(UObject::FAssetRegistryTag(FJointAssetRegistryTags::NodeClassPackages, FJointAssetRegistryTags::MakeList(NodeClassPackageNames.Array()), UObject::FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(UObject::FAssetRegistryTag(FJointAssetRegistryTags::NativeNodeClasses, FJointAssetRegistryTags::MakeList(NativeNodeClassNames.Array()), UObject::FAssetRegistryTag::TT_Hidden));
+}
+
 void FJointEdUtils::RemoveGraph(UJointEdGraph* GraphToRemove)
 {
 	if (GraphToRemove == nullptr) return;
@@ -764,6 +877,7 @@ void FJointEdUtils::RemoveGraph(UJointEdGraph* GraphToRemove)
 			{
 				ParentJointGraph->Modify();
 				ParentJointGraph->SubGraphs.Remove(GraphToRemove);
+				ParentJointGraph->NotifyGraphHierarchyChanged();
 			}
 		}
 
@@ -0,0 +1,468 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#include "JointAssetSweep.h"
+
+#include "JointEditorLogChannels.h"
+#include "SharedType/JointAssetRegistryTags.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Misc/PackageName.h"
+#include "Widgets/SWidget.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+
+#include "AssetRegistryModule.h"
+
+#else
+
+#include "AssetRegistry/AssetRegistryModule.h"
+
+#endif
+
+#define LOCTEXT_NAMESPACE "JointAssetSweep"
+
+namespace JointAssetSweepDefs
+{
+	//The number of the assets to request on a single async load.
+	static constexpr int32 BatchSize = 16;
+
+	//The time a single tick can spend on processing the loaded assets, in seconds. One asset is processed at least per tick.
+	static constexpr double TimeBudget = 0.008;
+}
+
+bool FJointAssetSweepCache::IsUpToDate(const FAssetData& AssetData) const
+{
+	const FString* RecordedHash = ProcessedPackageHashes.Find(AssetData.PackageName);
+
+	if (RecordedHash == nullptr || RecordedHash->IsEmpty()) return false;
+
+	return *RecordedHash == GetPackageSavedHash(AssetData.PackageName);
+}
+
+void FJointAssetSweepCache::Record(const FAssetData& AssetData)
+{
+	const FString SavedHash = GetPackageSavedHash(AssetData.PackageName);
+
+	//Can't tell whether the package changes later. Don't record it at all.
+	if (SavedHash.IsEmpty())
+	{
+		ProcessedPackageHashes.Remove(AssetData.PackageName);
+
+		return;
+	}
+
+	ProcessedPackageHashes.Add(AssetData.PackageName, SavedHash);
+}
+
+void FJointAssetSweepCache::Forget(const FName& PackageName)
+{
+	ProcessedPackageHashes.Remove(PackageName);
+}
+
+void FJointAssetSweepCache::Reset()
+{
+	ProcessedPackageHashes.Reset();
+}
+
+FString FJointAssetSweepCache::GetPackageSavedHash(const FName& PackageName)
+{
+	//The unsaved changes are not represented by the saved hash.
+	if (const UPackage* Package = FindPackage(nullptr, *PackageName.ToString()); Package && Package->IsDirty()) return FString();
+
+	const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+	const TOptional<FAssetPackageData> PackageData = AssetRegistryModule.Get().GetAssetPackageDataCopy(PackageName);
+
+	if (!PackageData.IsSet()) return FString();
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+
+	PRAGMA_DISABLE_DEPRECATION_WARNINGS
+	return PackageData->PackageGuid.ToString();
+	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+#else
+
+	return LexToString(PackageData->GetPackageSavedHash());
+
+#endif
+}
+
+
+FJointAssetSweep::FJointAssetSweep(const FText& InSweepName, const TArray<FAssetData>& InAssets) :
+	SweepName(InSweepName),
+	PendingAssets(InAssets),
+	NumTotal(InAssets.Num())
+{
+}
+
+FJointAssetSweep::~FJointAssetSweep()
+{
+	if (LoadingHandle.IsValid()) LoadingHandle->CancelHandle();
+
+	for (const TSharedPtr<FStreamableHandle>& LoadedHandle : LoadedHandles)
+	{
+		if (LoadedHandle.IsValid()) LoadedHandle->ReleaseHandle();
+	}
+
+	if (Notification.IsValid())
+	{
+		Notification->SetCompletionState(SNotificationItem::CS_Fail);
+		Notification->ExpireAndFadeout();
+	}
+}
+
+void FJointAssetSweep::Start()
+{
+	if (bIsRunning) return;
+
+	bIsRunning = true;
+
+	//Sort out the assets that don't need to be loaded at all first.
+	for (int32 Index = PendingAssets.Num() - 1; Index >= 0; --Index)
+	{
+		const FAssetData& AssetData = PendingAssets[Index];
+
+		if ((AssetFilter && !AssetFilter(AssetData)) || (Cache.IsValid() && Cache->IsUpToDate(AssetData)))
+		{
+			++NumSkipped;
+
+			PendingAssets.RemoveAtSwap(Index, 1, false);
+		}
+	}
+
+	//The already loaded assets can be processed right away.
+	for (int32 Index = PendingAssets.Num() - 1; Index >= 0; --Index)
+	{
+		if (!PendingAssets[Index].IsAssetLoaded()) continue;
+
+		ReadyAssets.Add(PendingAssets[Index]);
+
+		PendingAssets.RemoveAtSwap(Index, 1, false);
+	}
+
+	FNotificationInfo Info(SweepName);
+	Info.bFireAndForget = false;
+	Info.bUseThrobber = true;
+	Info.FadeOutDuration = 1.f;
+	Info.ExpireDuration = 2.5f;
+
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		LOCTEXT("CancelSweep", "Cancel"),
+		LOCTEXT("CancelSweepToolTip", "Stop the sweep. The assets that have been processed already will keep their changes."),
+		FSimpleDelegate::CreateSP(this, &FJointAssetSweep::Cancel),
+		SNotificationItem::CS_Pending));
+
+	Notification = FSlateNotificationManager::Get().AddNotification(Info);
+
+	if (Notification.IsValid()) Notification->SetCompletionState(SNotificationItem::CS_Pending);
+
+	RequestNextBatch();
+
+	UpdateNotification();
+}
+
+bool FJointAssetSweep::StartOnWidget(const TSharedRef<SWidget>& OwnerWidget, TSharedPtr<FJointAssetSweep>& InOutActiveSweep, const TSharedRef<FJointAssetSweep>& Sweep)
+{
+	if (InOutActiveSweep.IsValid() && InOutActiveSweep->IsRunning())
+	{
+		FNotificationInfo Info(LOCTEXT("SweepAlreadyRunning", "Another operation is still running on the assets. Please wait or cancel it first."));
+		Info.bFireAndForget = true;
+		Info.ExpireDuration = 2.5f;
+
+		FSlateNotificationManager::Get().AddNotification(Info);
+
+		return false;
+	}
+
+	InOutActiveSweep = Sweep;
+
+	Sweep->Start();
+
+	//The active timer is owned by the widget, so the slot (a member of the widget) outlives it.
+	OwnerWidget->RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateLambda([ActiveSweepSlot = &InOutActiveSweep, Sweep](double InCurrentTime, float InDeltaTime)
+	{
+		if (Sweep->Tick()) return EActiveTimerReturnType::Continue;
+
+		if (*ActiveSweepSlot == Sweep) ActiveSweepSlot->Reset();
+
+		return EActiveTimerReturnType::Stop;
+	}));
+
+	return true;
+}
+
+bool FJointAssetSweep::Tick()
+{
+	if (!bIsRunning) return false;
+
+	if (bIsCancelled)
+	{
+		Finish();
+
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	while (!ReadyAssets.IsEmpty())
+	{
+		const FAssetData AssetData = ReadyAssets.Pop(false);
+
+		if (UObject* Asset = AssetData.FastGetAsset(false))
+		{
+			if (ProcessAsset) ProcessAsset(Asset, AssetData);
+
+			if (Cache.IsValid()) Cache->Record(AssetData);
+		}
+		else
+		{
+			UE_LOG(LogJointEditor, Warning, TEXT("Joint asset sweep: failed to load %s."), *AssetData.PackageName.ToString());
+		}
+
+		++NumProcessed;
+
+		if (FPlatformTime::Seconds() - StartTime > JointAssetSweepDefs::TimeBudget) break;
+	}
+
+	if (ReadyAssets.IsEmpty())
+	{
+		for (const TSharedPtr<FStreamableHandle>& LoadedHandle : LoadedHandles)
+		{
+			if (LoadedHandle.IsValid()) LoadedHandle->ReleaseHandle();
+		}
+
+		LoadedHandles.Reset();
+	}
+
+	UpdateNotification();
+
+	if (ReadyAssets.IsEmpty() && PendingAssets.IsEmpty() && !bIsBatchLoading)
+	{
+		Finish();
+
+		return false;
+	}
+
+	return true;
+}
+
+void FJointAssetSweep::Cancel()
+{
+	bIsCancelled = true;
+
+	bIsBatchLoading = false;
+
+	if (LoadingHandle.IsValid())
+	{
+		LoadingHandle->CancelHandle();
+		LoadingHandle.Reset();
+	}
+}
+
+bool FJointAssetSweep::IsRunning() const
+{
+	return bIsRunning;
+}
+
+bool FJointAssetSweep::IsCancelled() const
+{
+	return bIsCancelled;
+}
+
+int32 FJointAssetSweep::GetNumTotal() const
+{
+	return NumTotal;
+}
+
+int32 FJointAssetSweep::GetNumProcessed() const
+{
+	return NumProcessed;
+}
+
+int32 FJointAssetSweep::GetNumSkipped() const
+{
+	return NumSkipped;
+}
+
+void FJointAssetSweep::GetAssetsOfClass(const UClass* Class, TArray<FAssetData>& OutAssets)
+{
+	if (Class == nullptr) return;
+
+	const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+
+	AssetRegistryModule.Get().GetAssetsByClass(Class->GetFName(), OutAssets);
+
+#else
+
+	AssetRegistryModule.Get().GetAssetsByClass(Class->GetClassPathName(), OutAssets);
+
+#endif
+}
+
+bool FJointAssetSweep::MayContainClass(const FAssetData& AssetData, const UClass* Class)
+{
+	if (Class == nullptr) return false;
+
+	//The tags of the loaded assets can be out of date with their unsaved changes, and they are cheap to check anyway.
+	if (AssetData.IsAssetLoaded()) return true;
+
+	const FString ClassPath = Class->GetPathName();
+
+	bool bHasAnyTag = false;
+
+	for (const FName& TagName : {FJointAssetRegistryTags::NodeClasses, FJointAssetRegistryTags::FragmentClasses, FJointAssetRegistryTags::EditorNodeClasses})
+	{
+		FString ListValue;
+
+		if (!AssetData.GetTagValue(TagName, ListValue)) continue;
+
+		bHasAnyTag = true;
+
+		if (FJointAssetRegistryTags::ListContains(ListValue, ClassPath)) return true;
+	}
+
+	return !bHasAnyTag;
+}
+
+bool FJointAssetSweep::MayHaveMissingClasses(const FAssetData& AssetData)
+{
+	if (AssetData.IsAssetLoaded()) return true;
+
+	FString ListValue;
+
+	if (!AssetData.GetTagValue(FJointAssetRegistryTags::NodeClassPackages, ListValue)) return true;
+
+	TArray<FString> PackageNames;
+
+	FJointAssetRegistryTags::ParseList(ListValue, PackageNames);
+
+	for (const FString& PackageName : PackageNames)
+	{
+		if (!FPackageName::DoesPackageExist(PackageName)) return true;
+	}
+
+	//The assets saved before the native classes were recorded can't be told.
+	if (!AssetData.GetTagValue(FJointAssetRegistryTags::NativeNodeClasses, ListValue)) return true;
+
+	TArray<FString> NativeClassNames;
+
+	FJointAssetRegistryTags::ParseList(ListValue, NativeClassNames);
+
+	//Every native class of the editor is loaded already, so a lookup in memory is enough.
+	for (const FString& NativeClassName : NativeClassNames)
+	{
+		if (!FPackageName::IsValidObjectPath(NativeClassName)) return true;
+
+		if (FindObject<UClass>(nullptr, *NativeClassName) == nullptr) return true;
+	}
+
+	return false;
+}
+
+void FJointAssetSweep::RequestNextBatch()
+{
+	if (bIsCancelled || bIsBatchLoading || PendingAssets.IsEmpty()) return;
+
+	const int32 BatchNum = FMath::Min(JointAssetSweepDefs::BatchSize, PendingAssets.Num());
+
+	TArray<FAssetData> Batch;
+	Batch.Append(PendingAssets.GetData() + PendingAssets.Num() - BatchNum, BatchNum);
+
+	PendingAssets.RemoveAt(PendingAssets.Num() - BatchNum, BatchNum, false);
+
+	TArray<FSoftObjectPath> AssetPaths;
+	AssetPaths.Reserve(Batch.Num());
+
+	for (const FAssetData& AssetData : Batch)
+	{
+		AssetPaths.Add(AssetData.ToSoftObjectPath());
+	}
+
+	bIsBatchLoading = true;
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetPaths,
+		FStreamableDelegate::CreateSP(this, &FJointAssetSweep::OnBatchLoaded, Batch),
+		FStreamableManager::DefaultAsyncLoadPriority,
+		false,
+		false,
+		TEXT("JointAssetSweep"));
+
+	//The delegate can be executed before the request returns if everything was loaded already.
+	if (bIsBatchLoading)
+	{
+		LoadingHandle = Handle;
+	}
+	else if (Handle.IsValid())
+	{
+		LoadedHandles.Add(Handle);
+	}
+}
+
+void FJointAssetSweep::OnBatchLoaded(TArray<FAssetData> LoadedBatch)
+{
+	ReadyAssets.Append(MoveTemp(LoadedBatch));
+
+	if (LoadingHandle.IsValid()) LoadedHandles.Add(LoadingHandle);
+
+	LoadingHandle.Reset();
+
+	bIsBatchLoading = false;
+
+	RequestNextBatch();
+}
+
+void FJointAssetSweep::Finish()
+{
+	if (!bIsRunning) return;
+
+	bIsRunning = false;
+
+	bIsBatchLoading = false;
+
+	if (LoadingHandle.IsValid())
+	{
+		LoadingHandle->CancelHandle();
+		LoadingHandle.Reset();
+	}
+
+	for (const TSharedPtr<FStreamableHandle>& LoadedHandle : LoadedHandles)
+	{
+		if (LoadedHandle.IsValid()) LoadedHandle->ReleaseHandle();
+	}
+
+	LoadedHandles.Reset();
+
+	PendingAssets.Reset();
+	ReadyAssets.Reset();
+
+	if (Notification.IsValid())
+	{
+		Notification->SetText(bIsCancelled
+			? FText::Format(LOCTEXT("SweepCancelled", "{0} - Cancelled. ({1} / {2} processed)"), SweepName, NumProcessed, NumTotal - NumSkipped)
+			: FText::Format(LOCTEXT("SweepFinished", "{0} - Done. ({1} processed, {2} skipped)"), SweepName, NumProcessed, NumSkipped));
+
+		Notification->SetCompletionState(bIsCancelled ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+		Notification->ExpireAndFadeout();
+		Notification.Reset();
+	}
+
+	UE_LOG(LogJointEditor, Log, TEXT("%s: processed %d assets, skipped %d assets%s."), *SweepName.ToString(), NumProcessed, NumSkipped, bIsCancelled ? TEXT(" (cancelled)") : TEXT(""));
+
+	if (OnFinished) OnFinished(*this);
+}
+
+void FJointAssetSweep::UpdateNotification() const
+{
+	if (!Notification.IsValid()) return;
+
+	Notification->SetText(FText::Format(LOCTEXT("SweepProgress", "{0} ({1} / {2})"), SweepName, NumProcessed, NumTotal - NumSkipped));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -4,6 +4,7 @@
 
 #include "ISettingsEditorModule.h"
 #include "JointAdvancedWidgets.h"
+#include "JointAssetSweep.h"
 
 #include "JointEdGraph.h"
 #include "JointEditor.h"
@@ -17,6 +18,7 @@
 #include "Framework/Notifications/NotificationManager.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/PackageName.h"
 #include "UObject/CoreRedirects.h"
 #include "Widgets/Docking/SDockTab.h"
 #include "Widgets/Images/SImage.h"
@@ -634,64 +636,61 @@ FReply SJointEditorUtilityTab::ReconstructEveryNodeInOpenedJointManagerEditor()
 
 FReply SJointEditorUtilityTab::CleanUpUnnecessaryNodes()
 {
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<
-		FAssetRegistryModule>("AssetRegistry");
-
 	TArray<FAssetData> AssetData;
 
-#if UE_VERSION_OLDER_THAN(5, 1, 0)
-
-	AssetRegistryModule.Get().GetAssetsByClass(UJointManager::StaticClass()->GetFName(), AssetData);
+	FJointAssetSweep::GetAssetsOfClass(UJointManager::StaticClass(), AssetData);
 
-#else
+	if (!CleanUpSweepCache.IsValid()) CleanUpSweepCache = MakeShared<FJointAssetSweepCache>();
 
-	AssetRegistryModule.Get().GetAssetsByClass(UJointManager::StaticClass()->GetClassPathName(), AssetData);
+	const TSharedRef<FJointAssetSweep> Sweep = MakeShared<FJointAssetSweep>(LOCTEXT("CleanUpSweep", "Cleaning up unnecessary nodes"), AssetData);
 
-#endif
+	Sweep->Cache = CleanUpSweepCache;
 
-	for (const FAssetData& Data : AssetData)
+	Sweep->ProcessAsset = [](UObject* Asset, const FAssetData& Data)
 	{
-		if (!Data.GetAsset()) continue;
-
-		if (UJointManager* Manager = Cast<UJointManager>(Data.GetAsset()))
+		if (UJointManager* Manager = Cast<UJointManager>(Asset))
 		{
-			if (!Manager || !Manager->JointGraph) continue;
+			if (!Manager || !Manager->JointGraph) return;
 
 			UJointEdGraph* CastedGraph = Cast<UJointEdGraph>(Manager->JointGraph);
 
-			if (!CastedGraph) continue;
+			if (!CastedGraph) return;
 
 			CastedGraph->RemoveOrphanedNodes();
 		}
-	}
+	};
+
+	FJointAssetSweep::StartOnWidget(SharedThis(this), ActiveSweep, Sweep);
 
 	return FReply::Handled();
 }
 
 FReply SJointEditorUtilityTab::UpdateBPNodeEdSettings()
 {
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<
-		FAssetRegistryModule>("AssetRegistry");
-
 	TArray<FAssetData> AssetData;
 
-#if UE_VERSION_OLDER_THAN(5, 1, 0)
+	FJointAssetSweep::GetAssetsOfClass(UBlueprint::StaticClass(), AssetData);
 
-	AssetRegistryModule.Get().GetAssetsByClass(UBlueprint::StaticClass()->GetFName(), AssetData);
+	const TSharedRef<int32> Count = MakeShared<int32>(0);
 
-#else
+	const TSharedRef<FJointAssetSweep> Sweep = MakeShared<FJointAssetSweep>(LOCTEXT("UpdateBPNodeEdSettingsSweep", "Updating Joint node blueprints' editor settings"), AssetData);
 
-	AssetRegistryModule.Get().GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetData);
+	//Don't load the blueprints that are not the Joint nodes. The native parent class is stored on the asset registry tags.
+	Sweep->AssetFilter = [](const FAssetData& Data)
+	{
+		FString NativeParentClassPath;
 
-#endif
+		//Can't tell without loading it.
+		if (!Data.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassPath)) return true;
 
-	int Count = 0;
+		const UClass* NativeParentClass = FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentClassPath));
 
-	for (const FAssetData& Data : AssetData)
-	{
-		if (!Data.GetAsset()) continue;
+		return NativeParentClass == nullptr || NativeParentClass->IsChildOf(UJointNodeBase::StaticClass());
+	};
 
-		if (UBlueprint* Blueprint = Cast<UBlueprint>(Data.GetAsset()))
+	Sweep->ProcessAsset = [Count](UObject* Asset, const FAssetData& Data)
+	{
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
 		{
 			if (Blueprint->GeneratedClass && Blueprint->GeneratedClass->IsChildOf(UJointNodeBase::StaticClass()))
 			{
@@ -712,24 +711,28 @@ FReply SJointEditorUtilityTab::UpdateBPNodeEdSettings()
 
 				Blueprint->MarkPackageDirty();
 
-				Count++;
+				++Count.Get();
 			}
 		}
-	}
+	};
 
-	FNotificationInfo Info(
-		FText::Format(
-			LOCTEXT("UpdatedEdSettings",
-			        "Updated {0} Joint Node Blueprint's Editor Settings. Save your project to apply the changes."),
-			FText::FromString(FString::FromInt(Count)))
-	);
-	Info.ExpireDuration = 5.0f;
-	Info.bUseLargeFont = false;
-	Info.bUseThrobber = false;
-	Info.bFireAndForget = true;
+	Sweep->OnFinished = [Count](const FJointAssetSweep& FinishedSweep)
+	{
+		FNotificationInfo Info(
+			FText::Format(
+				LOCTEXT("UpdatedEdSettings",
+						"Updated {0} Joint Node Blueprint's Editor Settings. Save your project to apply the changes."),
+				FText::FromString(FString::FromInt(Count.Get())))
+		);
+		Info.ExpireDuration = 5.0f;
+		Info.bUseLargeFont = false;
+		Info.bUseThrobber = false;
+		Info.bFireAndForget = true;
 
-	FSlateNotificationManager::Get().AddNotification(Info);
+		FSlateNotificationManager::Get().AddNotification(Info);
+	};
 
+	FJointAssetSweep::StartOnWidget(SharedThis(this), ActiveSweep, Sweep);
 
 	return FReply::Handled();
 }
@@ -750,6 +753,7 @@ FReply SJointEditorUtilityTab::ResetAllEditorStyle()
 		Settings->CenterGridColor = JointEditorDefaultSettings::CenterGridColor;
 		Settings->SmallestGridSize = JointEditorDefaultSettings::SmallestGridSize;
 		Settings->GridSnapSize = JointEditorDefaultSettings::GridSnapSize;
+		Settings->bUseZoomBasedNodeLOD = JointEditorDefaultSettings::bUseZoomBasedNodeLOD;
 
 
 		Settings->ContextTextEditorFontSizeMultiplier = JointEditorDefaultSettings::ContextTextEditorFontSizeMultiplier;
@@ -804,6 +808,7 @@ FReply SJointEditorUtilityTab::ResetAllEditorStyle()
 		Settings->RecursiveConnectionWiggleWireConfig = JointEditorDefaultSettings::WiggleWireConfig;
 		Settings->SelfConnectionWiggleWireConfig = JointEditorDefaultSettings::WiggleWireConfig;
 		Settings->PreviewConnectionWiggleWireConfig = JointEditorDefaultSettings::WiggleWireConfig;
+		Settings->WiggleWireSimulationTimeBudget = JointEditorDefaultSettings::WiggleWireSimulationTimeBudget;
 		
 		Settings->DebuggerPlayingNodeColor = JointEditorDefaultSettings::DebuggerPlayingNodeColor;
 		Settings->DebuggerPlayingNodeColor = JointEditorDefaultSettings::DebuggerPlayingNodeColor;
@@ -830,6 +835,7 @@ FReply SJointEditorUtilityTab::ResetGraphEditorStyle()
 		Settings->CenterGridColor = JointEditorDefaultSettings::CenterGridColor;
 		Settings->SmallestGridSize = JointEditorDefaultSettings::SmallestGridSize;
 		Settings->GridSnapSize = JointEditorDefaultSettings::GridSnapSize;
+		Settings->bUseZoomBasedNodeLOD = JointEditorDefaultSettings::bUseZoomBasedNodeLOD;
 
 		UJointEditorSettings::Save();
 	}
@@ -1481,41 +1487,106 @@ FReply SJointEditorTap_MissingClassesMap::AllocatedRedirectionRefresh()
 
 FReply SJointEditorTap_MissingClassesMap::MissingClassRefresh()
 {
-	if (MissingClassScrollBox.IsValid()) MissingClassScrollBox->ClearChildren();
+	TArray<FAssetData> AssetData;
 
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<
-		FAssetRegistryModule>("AssetRegistry");
+	FJointAssetSweep::GetAssetsOfClass(UJointManager::StaticClass(), AssetData);
 
-	TArray<FAssetData> AssetData;
+	//Forget the results of the packages that don't exist anymore.
+	TSet<FName> ExistingPackageNames;
 
-#if UE_VERSION_OLDER_THAN(5, 1, 0)
+	for (const FAssetData& Data : AssetData) ExistingPackageNames.Add(Data.PackageName);
 
-	AssetRegistryModule.Get().GetAssetsByClass(UJointManager::StaticClass()->GetFName(), AssetData);
+	for (TMap<FName, TArray<FJointGraphNodeClassData>>::TIterator It = MissingClassesByPackage.CreateIterator(); It; ++It)
+	{
+		if (!ExistingPackageNames.Contains(It.Key())) It.RemoveCurrent();
+	}
 
-#else
+	if (!MissingClassSweepCache.IsValid()) MissingClassSweepCache = MakeShared<FJointAssetSweepCache>();
 
-	AssetRegistryModule.Get().GetAssetsByClass(UJointManager::StaticClass()->GetClassPathName(), AssetData);
+	const TSharedRef<FJointAssetSweep> Sweep = MakeShared<FJointAssetSweep>(LOCTEXT("MissingClassSweep", "Auditing missing node classes"), AssetData);
 
-#endif
+	Sweep->Cache = MissingClassSweepCache;
 
-	for (const FAssetData& Data : AssetData)
+	//The assets whose node classes all exist can't have a missing class.
+	Sweep->AssetFilter = [this](const FAssetData& Data)
 	{
-		if (!Data.GetAsset()) continue;
+		if (FJointAssetSweep::MayHaveMissingClasses(Data))
+		{
+			//A class might have been removed since the last audit without the asset being saved again. The saved hash of the asset can't tell it, so audit it again.
+			MissingClassSweepCache->Forget(Data.PackageName);
 
-		UJointManager* Manager = Cast<UJointManager>(Data.GetAsset());
-		
-		TArray<UJointEdGraph*> Graphs = UJointEdGraph::GetAllGraphsFrom(Manager);
+			return true;
+		}
 
-		for (UJointEdGraph* Graph : Graphs)
+		MissingClassesByPackage.Remove(Data.PackageName);
+
+		return false;
+	};
+
+	//The sweep is owned by this widget and only ticked by its active timer, so it never outlives it.
+	Sweep->ProcessAsset = [this](UObject* Asset, const FAssetData& Data)
+	{
+		UJointManager* Manager = Cast<UJointManager>(Asset);
+
+		if (!Manager) return;
+
+		TArray<FJointGraphNodeClassData>& MissingClasses = MissingClassesByPackage.FindOrAdd(Data.PackageName);
+
+		MissingClasses.Reset();
+
+		for (UJointEdGraph* Graph : UJointEdGraph::GetAllGraphsFrom(Manager))
 		{
 			if (!Graph) continue;
 			
 			Graph->UpdateClassData();
 
 			Graph->GrabUnknownClassDataFromGraph();
+
+			for (const TWeakObjectPtr<UJointEdGraphNode>& GraphNode : Graph->GetCachedJointGraphNodes())
+			{
+				if (!GraphNode.IsValid() || FJointGraphNodeClassHelper::IsClassKnown(GraphNode->NodeClassData)) continue;
+
+				MissingClasses.AddUnique(GraphNode->NodeClassData);
+			}
 		}
-	}
-	
+	};
+
+	Sweep->OnFinished = [this](const FJointAssetSweep& FinishedSweep)
+	{
+		//The skipped packages haven't been changed, but the classes they were missing might have been added since then.
+		//Ask the class database of the node classes rather than the disk - it already knows every blueprint node class in the project.
+		FJointEditorModule* Module = FJointEditorModule::Get();
+
+		const TSharedPtr<FJointGraphNodeClassHelper> ClassCache = Module ? Module->GetClassCache() : nullptr;
+
+		for (TPair<FName, TArray<FJointGraphNodeClassData>>& MissingClassesPair : MissingClassesByPackage)
+		{
+			MissingClassesPair.Value.RemoveAll([&ClassCache](const FJointGraphNodeClassData& ClassData)
+			{
+				return ClassCache.IsValid()
+					? ClassCache->ContainsClassPackage(ClassData.GetPackageName())
+					: FPackageName::DoesPackageExist(ClassData.GetPackageName());
+			});
+
+			for (const FJointGraphNodeClassData& ClassData : MissingClassesPair.Value)
+			{
+				FJointGraphNodeClassHelper::AddUnknownClass(ClassData);
+			}
+		}
+
+		PopulateMissingClassList();
+	};
+
+	FJointAssetSweep::StartOnWidget(SharedThis(this), ActiveSweep, Sweep);
+
+	return FReply::Handled();
+}
+
+void SJointEditorTap_MissingClassesMap::PopulateMissingClassList()
+{
+	if (!MissingClassScrollBox.IsValid()) return;
+
+	MissingClassScrollBox->ClearChildren();
 
 	if (FJointEditorModule* Module = FJointEditorModule::Get(); Module && Module->GetClassCache().IsValid())
 	{
@@ -1585,8 +1656,6 @@ FReply SJointEditorTap_MissingClassesMap::MissingClassRefresh()
 				]
 			];
 	}
-
-	return FReply::Handled();
 }
 
 void SJointEditorTap_MissingClassesMap::OnSetClass_NodeClassLeftSelectedClass(const UClass* Class)
@@ -1651,28 +1720,19 @@ FReply SJointEditorTap_MissingClassesMap::OnNodeClassChangeButtonClicked()
 	{
 	case EAppReturnType::Ok:
 		{
-			//Cache again.
-
-			FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
-				"AssetRegistry");
-
 			TArray<FAssetData> AssetData;
 
-#if UE_VERSION_OLDER_THAN(5, 1, 0)
-
-			AssetRegistryModule.Get().GetAssetsByClass(UJointManager::StaticClass()->GetFName(), AssetData);
+			FJointAssetSweep::GetAssetsOfClass(UJointManager::StaticClass(), AssetData);
 
-#else
+			const TSharedRef<FJointAssetSweep> Sweep = MakeShared<FJointAssetSweep>(LOCTEXT("NodeClassSwapSweep", "Swapping node classes"), AssetData);
 
-			AssetRegistryModule.Get().GetAssetsByClass(UJointManager::StaticClass()->GetClassPathName(), AssetData);
-
-#endif
+			Sweep->AssetFilter = [FromClass = NodeClassLeftSelectedClass](const FAssetData& Data)
+			{
+				return FJointAssetSweep::MayContainClass(Data, FromClass);
+			};
 
-			for (const FAssetData& Data : AssetData)
+			Sweep->ProcessAsset = [FromClass = NodeClassLeftSelectedClass, ToClass = NodeClassRightSelectedClass](UObject* Asset, const FAssetData& Data)
 			{
-				UObject* Asset = Data.GetAsset();
-				if (!Asset) continue;
-				
 				UJointManager* Manager = Cast<UJointManager>(Asset);
 				TArray<UJointEdGraph*> Graphs = UJointEdGraph::GetAllGraphsFrom(Manager);
 
@@ -1688,15 +1748,17 @@ FReply SJointEditorTap_MissingClassesMap::OnNodeClassChangeButtonClicked()
 
 						if (!NodeInstance) continue;
 
-						if (NodeInstance->GetClass() == NodeClassLeftSelectedClass)
+						if (NodeInstance->GetClass() == FromClass)
 						{
-							JointEdGraphNode->ReplaceNodeClassTo(NodeClassRightSelectedClass);
+							JointEdGraphNode->ReplaceNodeClassTo(ToClass);
 
 							Manager->MarkPackageDirty();
 						}
 					}
 				}
-			}
+			};
+
+			FJointAssetSweep::StartOnWidget(SharedThis(this), ActiveSweep, Sweep);
 
 			break;
 		}
@@ -1755,28 +1817,19 @@ FReply SJointEditorTap_MissingClassesMap::OnEditorNodeClassChangeButtonClicked()
 	{
 	case EAppReturnType::Ok:
 		{
-			//Cache again.
-
-			FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
-				"AssetRegistry");
-
 			TArray<FAssetData> AssetData;
 
-#if UE_VERSION_OLDER_THAN(5, 1, 0)
-
-			AssetRegistryModule.Get().GetAssetsByClass(UJointManager::StaticClass()->GetFName(), AssetData);
-
-#else
+			FJointAssetSweep::GetAssetsOfClass(UJointManager::StaticClass(), AssetData);
 
-			AssetRegistryModule.Get().GetAssetsByClass(UJointManager::StaticClass()->GetClassPathName(), AssetData);
+			const TSharedRef<FJointAssetSweep> Sweep = MakeShared<FJointAssetSweep>(LOCTEXT("EditorNodeClassSwapSweep", "Swapping editor node classes"), AssetData);
 
-#endif
+			Sweep->AssetFilter = [FromClass = EditorNodeClassLeftSelectedClass](const FAssetData& Data)
+			{
+				return FJointAssetSweep::MayContainClass(Data, FromClass);
+			};
 
-			for (const FAssetData& Data : AssetData)
+			Sweep->ProcessAsset = [FromClass = EditorNodeClassLeftSelectedClass, ToClass = EditorNodeClassRightSelectedClass](UObject* Asset, const FAssetData& Data)
 			{
-				UObject* Asset = Data.GetAsset();
-				if (!Asset) continue;
-				
 				UJointManager* Manager = Cast<UJointManager>(Asset);
 				TArray<UJointEdGraph*> Graphs = UJointEdGraph::GetAllGraphsFrom(Manager);
 
@@ -1788,15 +1841,17 @@ FReply SJointEditorTap_MissingClassesMap::OnEditorNodeClassChangeButtonClicked()
 					TSet<TWeakObjectPtr<UJointEdGraphNode>> EditorNodes = Graph->GetCachedJointGraphNodes(true);
 					for (TWeakObjectPtr<UJointEdGraphNode> JointEdGraphNode : EditorNodes)
 					{
-						if (JointEdGraphNode->GetClass() == EditorNodeClassLeftSelectedClass)
+						if (JointEdGraphNode->GetClass() == FromClass)
 						{
-							JointEdGraphNode->ReplaceEditorNodeClassTo(EditorNodeClassRightSelectedClass);
+							JointEdGraphNode->ReplaceEditorNodeClassTo(ToClass);
 
 							Manager->MarkPackageDirty();
 						}
 					}
 				}
-			}
+			};
+
+			FJointAssetSweep::StartOnWidget(SharedThis(this), ActiveSweep, Sweep);
 
 			break;
 		}
@@ -0,0 +1,497 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#include "SearchTree/Index/JointSearchIndex.h"
+
+#include "JointEdGraph.h"
+#include "JointEdGraphNode.h"
+#include "JointEdGraphNode_Reroute.h"
+#include "JointEditorLogChannels.h"
+#include "JointAssetSweep.h"
+#include "JointManager.h"
+
+#include "Algo/BinarySearch.h"
+#include "EdGraphNode_Comment.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Node/JointNodeBase.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+
+#include "AssetRegistryModule.h"
+
+#else
+
+#include "AssetRegistry/AssetRegistryModule.h"
+
+#endif
+
+namespace JointSearchIndexDefs
+{
+	//Bump it whenever the way the texts are collected or normalized changes. The index of the other versions will be discarded.
+	static constexpr int32 Version = 2;
+
+	static constexpr uint32 FileMagic = 0x4A534958; // 'JSIX'
+
+	//The filter text of the item tags the search tree attaches on every asset. See IJointTreeItemTag::GetFilterText().
+	static const TCHAR* ItemTagTexts[] = {
+		TEXT("Tag:Graph"),
+		TEXT("Tag:Node"),
+		TEXT("Tag:Manager Fragment"),
+		TEXT("Tag:Comment"),
+		TEXT("Tag:Connector"),
+		TEXT("Tag:Composite"),
+		TEXT("Tag:Tunnel"),
+	};
+
+	//The keys of the filter strings of the tree items. They are on every item, so they can't narrow down anything.
+	static const TCHAR* FilterStringKeys[] = {
+		TEXT("name"),
+		TEXT("value"),
+		TEXT("tag"),
+		TEXT("displayname"),
+	};
+
+	//Normalize the text the same way the search tree normalizes the filter strings & the query, and lower it for the case insensitive matching.
+	FString Normalize(const FString& InText)
+	{
+		return InText.Replace(TEXT(" "), TEXT("_")).Replace(TEXT("!"), TEXT("$")).ToLower();
+	}
+
+	uint32 MakeTrigram(const TCHAR A, const TCHAR B, const TCHAR C)
+	{
+		const uint32 CharA = static_cast<uint32>(A);
+		const uint32 CharB = static_cast<uint32>(B);
+		const uint32 CharC = static_cast<uint32>(C);
+
+		//Exact for the single byte characters, hashed into the rest of the range for the others. A collision can only make a false positive.
+		if (CharA < 256 && CharB < 256 && CharC < 256) return (CharA << 16) | (CharB << 8) | CharC;
+
+		return 0x01000000 | (HashCombine(HashCombine(GetTypeHash(CharA), GetTypeHash(CharB)), GetTypeHash(CharC)) & 0x00FFFFFF);
+	}
+
+	void AddTrigrams(const FString& NormalizedText, TSet<uint32>& OutTrigrams)
+	{
+		for (int32 Index = 0; Index + 2 < NormalizedText.Len(); ++Index)
+		{
+			OutTrigrams.Add(MakeTrigram(NormalizedText[Index], NormalizedText[Index + 1], NormalizedText[Index + 2]));
+		}
+	}
+
+	//See CheckCanImplementProperty() of the tree builder. Only the properties the tree shows are searchable.
+	bool IsSearchableProperty(const FProperty* Property)
+	{
+		return Property
+			&& !Property->HasAnyPropertyFlags(CPF_DisableEditOnInstance)
+			&& !Property->HasAnyPropertyFlags(CPF_AdvancedDisplay)
+			&& Property->HasAnyPropertyFlags(CPF_Edit);
+	}
+
+	void CollectPropertyTexts(UObject* Object, TArray<FString>& OutTexts)
+	{
+		for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+		{
+			FProperty* Property = *It;
+
+			if (!IsSearchableProperty(Property)) continue;
+
+			FString ExportedStringValue;
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+			Property->ExportTextItem(ExportedStringValue, Property->ContainerPtrToValuePtr<uint8>(Object), NULL, NULL, PPF_PropertyWindow, NULL);
+#else
+			Property->ExportTextItem_Direct(ExportedStringValue, Property->ContainerPtrToValuePtr<uint8>(Object), NULL, NULL, PPF_PropertyWindow, NULL);
+#endif
+
+			OutTexts.Add(Normalize(Property->GetName()));
+			OutTexts.Add(Normalize(Property->GetCPPType()));
+			OutTexts.Add(Normalize(ExportedStringValue));
+		}
+	}
+}
+
+
+FJointSearchIndex::FJointSearchIndex()
+{
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FJointSearchIndex::OnPackageSaved);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FJointSearchIndex::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FJointSearchIndex::OnAssetRenamed);
+}
+
+FJointSearchIndex::~FJointSearchIndex()
+{
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		AssetRegistryModule->Get().OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+}
+
+void FJointSearchIndex::IndexJointManager(const UJointManager* InJointManager)
+{
+	if (InJointManager == nullptr) return;
+
+	Load();
+
+	const UPackage* Package = InJointManager->GetPackage();
+
+	TArray<FString> Texts;
+
+	CollectSearchableTexts(InJointManager, Texts);
+
+	TSet<uint32> Trigrams;
+
+	for (const FString& Text : Texts)
+	{
+		JointSearchIndexDefs::AddTrigrams(Text, Trigrams);
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(Package->GetFName());
+
+	Entry.PackageSavedHash = FJointAssetSweepCache::GetPackageSavedHash(Package->GetFName());
+	Entry.Trigrams = Trigrams.Array();
+	Entry.Trigrams.Sort();
+
+	bIsDirty = true;
+}
+
+void FJointSearchIndex::RemovePackage(const FName& PackageName)
+{
+	Load();
+
+	if (Entries.Remove(PackageName) > 0) bIsDirty = true;
+}
+
+bool FJointSearchIndex::IsUpToDate(const FAssetData& AssetData) const
+{
+	const FEntry* Entry = Entries.Find(AssetData.PackageName);
+
+	if (Entry == nullptr || Entry->PackageSavedHash.IsEmpty()) return false;
+
+	//Empty if the package is dirty, so it never matches then.
+	return Entry->PackageSavedHash == FJointAssetSweepCache::GetPackageSavedHash(AssetData.PackageName);
+}
+
+bool FJointSearchIndex::Query(const FString& Query, const TArray<FAssetData>& InAssets, TArray<FAssetData>& OutCandidates)
+{
+	Load();
+
+	ResolveAwaitingSavedHashes();
+
+	TArray<FString> Terms;
+
+	if (!ExtractQueryTerms(Query, Terms) || Terms.IsEmpty())
+	{
+		OutCandidates.Append(InAssets);
+
+		return false;
+	}
+
+	TArray<TArray<uint32>> TermTrigrams;
+	TermTrigrams.Reserve(Terms.Num());
+
+	for (const FString& Term : Terms)
+	{
+		TSet<uint32> Trigrams;
+
+		JointSearchIndexDefs::AddTrigrams(Term, Trigrams);
+
+		TermTrigrams.Add(Trigrams.Array());
+	}
+
+	for (const FAssetData& AssetData : InAssets)
+	{
+		const FEntry* Entry = Entries.Find(AssetData.PackageName);
+
+		if (Entry == nullptr || !IsUpToDate(AssetData) || MayMatch(*Entry, TermTrigrams))
+		{
+			OutCandidates.Add(AssetData);
+		}
+	}
+
+	return true;
+}
+
+int32 FJointSearchIndex::Num() const
+{
+	return Entries.Num();
+}
+
+bool FJointSearchIndex::MayMatch(const FEntry& Entry, const TArray<TArray<uint32>>& TermTrigrams) const
+{
+	for (const TArray<uint32>& Trigrams : TermTrigrams)
+	{
+		for (const uint32 Trigram : Trigrams)
+		{
+			if (Algo::BinarySearch(Entry.Trigrams, Trigram) == INDEX_NONE) return false;
+		}
+	}
+
+	return true;
+}
+
+void FJointSearchIndex::Load()
+{
+	if (bIsLoaded) return;
+
+	bIsLoaded = true;
+
+	TArray<uint8> Bytes;
+
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetIndexFilePath(), FILEREAD_Silent)) return;
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 NumEntries = 0;
+
+	Reader << Magic;
+	Reader << Version;
+
+	if (Magic != JointSearchIndexDefs::FileMagic || Version != JointSearchIndexDefs::Version)
+	{
+		UE_LOG(LogJointEditor, Log, TEXT("Joint search index: discarding the index of an old version. It will be rebuilt as the assets are saved."));
+
+		return;
+	}
+
+	Reader << NumEntries;
+
+	Entries.Reserve(NumEntries);
+
+	for (int32 Index = 0; Index < NumEntries && !Reader.IsError(); ++Index)
+	{
+		FString PackageName;
+		FEntry Entry;
+
+		Reader << PackageName;
+		Reader << Entry.PackageSavedHash;
+		Reader << Entry.Trigrams;
+
+		Entries.Add(FName(*PackageName), MoveTemp(Entry));
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogJointEditor, Warning, TEXT("Joint search index: failed to read %s. It will be rebuilt as the assets are saved."), *GetIndexFilePath());
+
+		Entries.Reset();
+	}
+}
+
+void FJointSearchIndex::Save()
+{
+	if (!bIsLoaded) return;
+
+	TArray<uint8> Bytes;
+
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = JointSearchIndexDefs::FileMagic;
+	int32 Version = JointSearchIndexDefs::Version;
+	int32 NumEntries = Entries.Num();
+
+	Writer << Magic;
+	Writer << Version;
+	Writer << NumEntries;
+
+	for (TPair<FName, FEntry>& Pair : Entries)
+	{
+		FString PackageName = Pair.Key.ToString();
+
+		Writer << PackageName;
+		Writer << Pair.Value.PackageSavedHash;
+		Writer << Pair.Value.Trigrams;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *GetIndexFilePath()))
+	{
+		UE_LOG(LogJointEditor, Warning, TEXT("Joint search index: failed to write %s."), *GetIndexFilePath());
+
+		return;
+	}
+
+	bIsDirty = false;
+}
+
+void FJointSearchIndex::SaveIfDirty()
+{
+	if (bIsDirty) Save();
+}
+
+void FJointSearchIndex::CollectSearchableTexts(const UJointManager* InJointManager, TArray<FString>& OutTexts)
+{
+	if (InJointManager == nullptr) return;
+
+	OutTexts.Add(JointSearchIndexDefs::Normalize(InJointManager->GetName()));
+
+	for (const TCHAR* ItemTagText : JointSearchIndexDefs::ItemTagTexts)
+	{
+		OutTexts.Add(JointSearchIndexDefs::Normalize(ItemTagText));
+	}
+
+	//Same as the objects the tree builder collects. See FJointTreeBuilder::CollectReferencesToBuild().
+	for (UJointEdGraph* Graph : UJointEdGraph::GetCachedGraphsFrom(InJointManager))
+	{
+		if (!Graph) continue;
+
+		OutTexts.Add(JointSearchIndexDefs::Normalize(Graph->GetName()));
+
+		for (const TWeakObjectPtr<UJointEdGraphNode>& GraphNode : Graph->GetCachedJointGraphNodes())
+		{
+			if (!GraphNode.IsValid() || GraphNode->IsA<UJointEdGraphNode_Reroute>()) continue;
+
+			OutTexts.Add(JointSearchIndexDefs::Normalize(GraphNode->GetName()));
+			OutTexts.Add(JointSearchIndexDefs::Normalize(GraphNode->GetNodeTitle(ENodeTitleType::FullTitle).ToString()));
+
+			if (UJointNodeBase* NodeInstance = GraphNode->GetCastedNodeInstance())
+			{
+				OutTexts.Add(JointSearchIndexDefs::Normalize(NodeInstance->GetName()));
+				OutTexts.Add(JointSearchIndexDefs::Normalize(NodeInstance->GetClass()->GetName()));
+
+				JointSearchIndexDefs::CollectPropertyTexts(NodeInstance, OutTexts);
+			}
+		}
+
+		for (UEdGraphNode* GraphNode : Graph->Nodes)
+		{
+			if (!Cast<UEdGraphNode_Comment>(GraphNode)) continue;
+
+			OutTexts.Add(JointSearchIndexDefs::Normalize(GraphNode->GetName()));
+			OutTexts.Add(JointSearchIndexDefs::Normalize(GraphNode->GetNodeTitle(ENodeTitleType::FullTitle).ToString()));
+		}
+	}
+}
+
+bool FJointSearchIndex::ExtractQueryTerms(const FString& Query, TArray<FString>& OutTerms)
+{
+	const FString NormalizedQuery = JointSearchIndexDefs::Normalize(Query);
+
+	//The alternatives & the negations can match the assets that have none of the terms.
+	//The '!' has been replaced with the '$' by the normalization, and the search tree does the same before the filtering, so it's a literal character here.
+	if (NormalizedQuery.Contains(TEXT("|")) || NormalizedQuery.Contains(TEXT("-"))
+		|| NormalizedQuery.Contains(TEXT("_or_")) || NormalizedQuery.Contains(TEXT("_not_")) || NormalizedQuery.StartsWith(TEXT("not_")))
+	{
+		return false;
+	}
+
+	TArray<FString> Pieces;
+
+	const TCHAR* Delimiters[] = {TEXT("&"), TEXT("("), TEXT(")"), TEXT("\""), TEXT("'"), TEXT("="), TEXT(":"), TEXT(","), TEXT("<"), TEXT(">")};
+
+	NormalizedQuery.ParseIntoArray(Pieces, Delimiters, UE_ARRAY_COUNT(Delimiters), true);
+
+	for (FString& Piece : Pieces)
+	{
+		//The spaces around the operators have been normalized into the underscores as well.
+		while (Piece.StartsWith(TEXT("_"))) Piece.RightChopInline(1);
+		while (Piece.EndsWith(TEXT("_"))) Piece.LeftChopInline(1);
+
+		if (Piece == TEXT("and")) continue;
+
+		bool bIsFilterStringKey = false;
+
+		for (const TCHAR* FilterStringKey : JointSearchIndexDefs::FilterStringKeys)
+		{
+			if (Piece == FilterStringKey)
+			{
+				bIsFilterStringKey = true;
+				break;
+			}
+		}
+
+		//The terms shorter than a trigram can't narrow down anything.
+		if (bIsFilterStringKey || Piece.Len() < 3) continue;
+
+		OutTerms.AddUnique(Piece);
+	}
+
+	return true;
+}
+
+FString FJointSearchIndex::GetIndexFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Joint") / TEXT("SearchIndex.bin");
+}
+
+void FJointSearchIndex::ResolveAwaitingSavedHashes()
+{
+	for (auto It = PackagesAwaitingSavedHash.CreateIterator(); It; ++It)
+	{
+		FEntry* Entry = Entries.Find(It.Key());
+
+		if (Entry == nullptr)
+		{
+			It.RemoveCurrent();
+
+			continue;
+		}
+
+		const FString SavedHash = FJointAssetSweepCache::GetPackageSavedHash(It.Key());
+
+		//The asset registry hasn't picked up the saved file yet (or the package got dirty again). Keep the entry untrusted for now.
+		if (SavedHash.IsEmpty() || SavedHash == It.Value()) continue;
+
+		Entry->PackageSavedHash = SavedHash;
+
+		bIsDirty = true;
+
+		It.RemoveCurrent();
+	}
+}
+
+void FJointSearchIndex::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	if (Package == nullptr || ObjectSaveContext.IsProceduralSave()) return;
+
+	ForEachObjectWithPackage(Package, [this, Package](UObject* Object)
+	{
+		if (const UJointManager* Manager = Cast<UJointManager>(Object))
+		{
+			Load();
+
+			const FEntry* PreviousEntry = Entries.Find(Package->GetFName());
+
+			const FString PreviousSavedHash = PreviousEntry ? PreviousEntry->PackageSavedHash : FString();
+
+			IndexJointManager(Manager);
+
+			//The saved hash in the asset registry still belongs to the previous file at this point. Take the new one on the next query.
+			if (FEntry* Entry = Entries.Find(Package->GetFName()))
+			{
+				Entry->PackageSavedHash.Reset();
+
+				PackagesAwaitingSavedHash.Add(Package->GetFName(), PreviousSavedHash);
+			}
+		}
+
+		return true;
+	}, false);
+}
+
+void FJointSearchIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (!bIsLoaded && !FPaths::FileExists(GetIndexFilePath())) return;
+
+	if (!Entries.Contains(AssetData.PackageName) && bIsLoaded) return;
+
+	RemovePackage(AssetData.PackageName);
+}
+
+void FJointSearchIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (!bIsLoaded && !FPaths::FileExists(GetIndexFilePath())) return;
+
+	RemovePackage(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+}
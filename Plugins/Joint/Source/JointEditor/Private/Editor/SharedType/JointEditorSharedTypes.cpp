@@ -26,7 +26,6 @@
 #include "UObject/CoreRedirects.h"
 #include "UObject/Object.h"
 #include "UObject/UObjectHash.h"
-#include "UObject/UObjectIterator.h"
 
 
 #define LOCTEXT_NAMESPACE "JointEditorSharedTypes"
@@ -199,7 +198,7 @@ FJointGraphNodeClassHelper::FJointGraphNodeClassHelper(UClass* InRootClass)
 	FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FJointGraphNodeClassHelper::OnReloadComplete);
 
 	// Register to have Populate called when a Blueprint is compiled.
-	GEditor->OnBlueprintCompiled().AddRaw(this, &FJointGraphNodeClassHelper::InvalidateCache);
+	GEditor->OnBlueprintCompiled().AddRaw(this, &FJointGraphNodeClassHelper::OnBlueprintCompiled);
 	GEditor->OnClassPackageLoadedOrUnloaded().AddRaw(this, &FJointGraphNodeClassHelper::InvalidateCache);
 
 	UpdateAvailableBlueprintClasses();
@@ -250,9 +249,24 @@ void FJointGraphNodeClassHelper::GatherClasses(const UClass* BaseClass,
 	{
 		BuildClassGraph();
 	}
+	else if (bBlueprintClassNodesDirty)
+	{
+		RefreshBlueprintClassNodes();
+	}
+
+	if (const TArray<FJointGraphNodeClassData>* CachedClasses = GatheredClasses.Find(BaseClassName))
+	{
+		AvailableClasses.Append(*CachedClasses);
+
+		return;
+	}
+
+	TArray<FJointGraphNodeClassData>& NewClasses = GatheredClasses.Add(BaseClassName);
 
 	TSharedPtr<FJointGraphNodeClassNode> BaseNode = FindBaseClassNode(RootNode, BaseClassName);
-	FindAllSubClasses(BaseNode, AvailableClasses);
+	FindAllSubClasses(BaseNode, NewClasses);
+
+	AvailableClasses.Append(NewClasses);
 }
 
 FString FJointGraphNodeClassHelper::GetDeprecationMessage(const UClass* Class)
@@ -307,13 +321,23 @@ bool FJointGraphNodeClassHelper::IsPackageSaved(FName PackageName)
 
 void FJointGraphNodeClassHelper::OnAssetAdded(const struct FAssetData& AssetData)
 {
-	TSharedPtr<FJointGraphNodeClassNode> Node = CreateClassDataNode(AssetData);
+	TSharedPtr<FJointGraphNodeClassNode> Node;
+
+	//Nothing to attach to until the database has been built - it will read the asset from the asset registry then.
+	if (RootNode.IsValid())
+	{
+		Node = CreateClassDataNode(AssetData);
+	}
 
 	TSharedPtr<FJointGraphNodeClassNode> ParentNode;
 	if (Node.IsValid())
 	{
 		ParentNode = FindBaseClassNode(RootNode, Node->ParentClassName);
+	}
 
+	//Any other blueprint is not a part of this database.
+	if (ParentNode.IsValid())
+	{
 		if (!IsPackageSaved(AssetData.PackageName))
 		{
 			UnknownPackages.AddUnique(FJointGraphNodeClassData(AssetData.GetClass()));
@@ -328,12 +352,20 @@ void FJointGraphNodeClassHelper::OnAssetAdded(const struct FAssetData& AssetData
 				OnPackageListUpdated.Broadcast();
 			}
 		}
-	}
 
-	if (ParentNode.IsValid())
-	{
-		ParentNode->AddUniqueSubNode(Node);
-		Node->ParentNode = ParentNode;
+		if (const TSharedPtr<FJointGraphNodeClassNode> ExistingNode = ClassNodeMap.FindRef(Node->Data.GetClassName()))
+		{
+			ExistingNode->Data = Node->Data;
+		}
+		else
+		{
+			ParentNode->AddUniqueSubNode(Node);
+			Node->ParentNode = ParentNode;
+
+			AddClassNodeToMap(Node);
+		}
+
+		ResetGatheredClasses();
 	}
 
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
@@ -356,6 +388,10 @@ void FJointGraphNodeClassHelper::OnAssetRemoved(const struct FAssetData& AssetDa
 		if (Node.IsValid() && Node->ParentNode.IsValid())
 		{
 			Node->ParentNode->SubNodes.RemoveSingleSwap(Node);
+
+			RemoveClassNodeFromMap(Node);
+
+			ResetGatheredClasses();
 		}
 	}
 
@@ -370,6 +406,10 @@ void FJointGraphNodeClassHelper::OnAssetRemoved(const struct FAssetData& AssetDa
 void FJointGraphNodeClassHelper::InvalidateCache()
 {
 	RootNode.Reset();
+	ClassNodeMap.Reset();
+	bBlueprintClassNodesDirty = false;
+
+	ResetGatheredClasses();
 
 	UpdateAvailableBlueprintClasses();
 }
@@ -379,6 +419,35 @@ void FJointGraphNodeClassHelper::OnReloadComplete(EReloadCompleteReason Reason)
 	InvalidateCache();
 }
 
+void FJointGraphNodeClassHelper::OnBlueprintCompiled()
+{
+	//A compile can't add or remove a native class, so only the blueprint classes have to be refreshed - and only when they are queried next time, since the blueprints are often compiled in batches.
+	bBlueprintClassNodesDirty = true;
+
+	ResetGatheredClasses();
+
+	UpdateAvailableBlueprintClasses();
+}
+
+bool FJointGraphNodeClassHelper::ContainsClassPackage(const FString& PackageName)
+{
+	if (!RootNode.IsValid())
+	{
+		BuildClassGraph();
+	}
+	else if (bBlueprintClassNodesDirty)
+	{
+		RefreshBlueprintClassNodes();
+	}
+
+	for (const TPair<FString, TSharedPtr<FJointGraphNodeClassNode>>& ClassNodePair : ClassNodeMap)
+	{
+		if (ClassNodePair.Value->Data.IsBlueprint() && ClassNodePair.Value->Data.GetPackageName() == PackageName) return true;
+	}
+
+	return false;
+}
+
 void FJointGraphNodeClassHelper::RemoveUnknownClass(const FJointGraphNodeClassData& ClassData)
 {
 	if (ClassData.IsBlueprint())
@@ -420,25 +489,28 @@ TSharedPtr<FJointGraphNodeClassNode> FJointGraphNodeClassHelper::CreateClassData
 TSharedPtr<FJointGraphNodeClassNode> FJointGraphNodeClassHelper::FindBaseClassNode(
 	TSharedPtr<FJointGraphNodeClassNode> Node, const FString& ClassName)
 {
-	TSharedPtr<FJointGraphNodeClassNode> RetNode;
-	if (Node.IsValid())
+	if (!Node.IsValid())
 	{
-		if (Node->Data.GetClassName() == ClassName)
-		{
-			return Node;
-		}
+		return nullptr;
+	}
 
-		for (int32 i = 0; i < Node->SubNodes.Num(); i++)
+	if (Node->Data.GetClassName() == ClassName)
+	{
+		return Node;
+	}
+
+	//Every node attached to the hierarchy is in the map, so look it up there and make sure it is under the provided node.
+	TSharedPtr<FJointGraphNodeClassNode> RetNode = ClassNodeMap.FindRef(ClassName);
+
+	for (TSharedPtr<FJointGraphNodeClassNode> TestNode = RetNode; TestNode.IsValid(); TestNode = TestNode->ParentNode)
+	{
+		if (TestNode == Node)
 		{
-			RetNode = FindBaseClassNode(Node->SubNodes[i], ClassName);
-			if (RetNode.IsValid())
-			{
-				break;
-			}
+			return RetNode;
 		}
 	}
 
-	return RetNode;
+	return nullptr;
 }
 
 void FJointGraphNodeClassHelper::FindAllSubClasses(TSharedPtr<FJointGraphNodeClassNode> Node,
@@ -480,11 +552,14 @@ void FJointGraphNodeClassHelper::BuildClassGraph()
 	TArray<UClass*> HideParentList;
 	RootNode.Reset();
 
-	// gather all native classes
-	for (TObjectIterator<UClass> It; It; ++It)
+	// gather all native classes - only the subclasses of the root class, instead of iterating every class in memory
+	TArray<UClass*> NativeClasses;
+	NativeClasses.Add(RootNodeClass);
+	GetDerivedClasses(RootNodeClass, NativeClasses, true);
+
+	for (UClass* TestClass : NativeClasses)
 	{
-		UClass* TestClass = *It;
-		if (TestClass->HasAnyClassFlags(CLASS_Native) && TestClass->IsChildOf(RootNodeClass))
+		if (TestClass->HasAnyClassFlags(CLASS_Native))
 		{
 			TSharedPtr<FJointGraphNodeClassNode> NewNode = MakeShareable(new FJointGraphNodeClassNode);
 			NewNode->ParentClassName = TestClass->GetSuperClass()->GetName();
@@ -522,31 +597,144 @@ void FJointGraphNodeClassHelper::BuildClassGraph()
 	}
 
 	// gather all blueprints
+	GatherBlueprintClassNodes(NodeList);
+
+	// build class tree
+	AddClassGraphChildren(RootNode, NodeList);
+
+	RebuildClassNodeMap();
+
+	bBlueprintClassNodesDirty = false;
+
+	ResetGatheredClasses();
+}
+
+void FJointGraphNodeClassHelper::GatherBlueprintClassNodes(TArray<TSharedPtr<FJointGraphNodeClassNode>>& OutNodeList)
+{
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
 		TEXT("AssetRegistry"));
+
+	// the asset registry knows the blueprint class hierarchy from the parent class tags, so only the blueprints derived from the root class are turned into nodes
 	TArray<FAssetData> BlueprintList;
 
 	FARFilter Filter;
 #if UE_VERSION_OLDER_THAN(5,1,0)
 
 	Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
-	
+
+	TSet<FName> DerivedClassNames;
+	AssetRegistryModule.Get().GetDerivedClassNames({RootNodeClass->GetFName()}, TSet<FName>(), DerivedClassNames);
+
 #else
 
 	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-	
+
+	TSet<FTopLevelAssetPath> DerivedClassNames;
+	AssetRegistryModule.Get().GetDerivedClassNames({RootNodeClass->GetClassPathName()}, TSet<FTopLevelAssetPath>(), DerivedClassNames);
+
 #endif
 
 	AssetRegistryModule.Get().GetAssets(Filter, BlueprintList);
 
-	for (int32 i = 0; i < BlueprintList.Num(); i++)
+	for (const FAssetData& BlueprintData : BlueprintList)
 	{
-		TSharedPtr<FJointGraphNodeClassNode> NewNode = CreateClassDataNode(BlueprintList[i]);
-		NodeList.Add(NewNode);
+		FString GeneratedClassPath;
+		if (!BlueprintData.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath))
+		{
+			continue;
+		}
+
+		ConstructorHelpers::StripObjectClass(GeneratedClassPath);
+
+#if UE_VERSION_OLDER_THAN(5,1,0)
+		if (!DerivedClassNames.Contains(FName(*FPackageName::ObjectPathToObjectName(GeneratedClassPath))))
+#else
+		if (!DerivedClassNames.Contains(FTopLevelAssetPath(GeneratedClassPath)))
+#endif
+		{
+			continue;
+		}
+
+		TSharedPtr<FJointGraphNodeClassNode> NewNode = CreateClassDataNode(BlueprintData);
+
+		if (NewNode.IsValid())
+		{
+			OutNodeList.Add(NewNode);
+		}
 	}
+}
 
-	// build class tree
-	AddClassGraphChildren(RootNode, NodeList);
+void FJointGraphNodeClassHelper::RefreshBlueprintClassNodes()
+{
+	bBlueprintClassNodesDirty = false;
+
+	TArray<TSharedPtr<FJointGraphNodeClassNode>> NativeNodes;
+
+	for (const TPair<FString, TSharedPtr<FJointGraphNodeClassNode>>& ClassNodePair : ClassNodeMap)
+	{
+		if (!ClassNodePair.Value->Data.IsBlueprint())
+		{
+			NativeNodes.Add(ClassNodePair.Value);
+		}
+	}
+
+	for (const TSharedPtr<FJointGraphNodeClassNode>& NativeNode : NativeNodes)
+	{
+		NativeNode->SubNodes.RemoveAll([](const TSharedPtr<FJointGraphNodeClassNode>& SubNode)
+		{
+			return SubNode->Data.IsBlueprint();
+		});
+	}
+
+	TArray<TSharedPtr<FJointGraphNodeClassNode>> BlueprintNodes;
+	GatherBlueprintClassNodes(BlueprintNodes);
+
+	for (const TSharedPtr<FJointGraphNodeClassNode>& NativeNode : NativeNodes)
+	{
+		if (BlueprintNodes.Num() == 0) break;
+
+		AddClassGraphChildren(NativeNode, BlueprintNodes);
+	}
+
+	RebuildClassNodeMap();
+
+	ResetGatheredClasses();
+}
+
+void FJointGraphNodeClassHelper::RebuildClassNodeMap()
+{
+	ClassNodeMap.Reset();
+
+	AddClassNodeToMap(RootNode);
+}
+
+void FJointGraphNodeClassHelper::AddClassNodeToMap(const TSharedPtr<FJointGraphNodeClassNode>& Node)
+{
+	if (!Node.IsValid()) return;
+
+	ClassNodeMap.Add(Node->Data.GetClassName(), Node);
+
+	for (const TSharedPtr<FJointGraphNodeClassNode>& SubNode : Node->SubNodes)
+	{
+		AddClassNodeToMap(SubNode);
+	}
+}
+
+void FJointGraphNodeClassHelper::RemoveClassNodeFromMap(const TSharedPtr<FJointGraphNodeClassNode>& Node)
+{
+	if (!Node.IsValid()) return;
+
+	ClassNodeMap.Remove(Node->Data.GetClassName());
+
+	for (const TSharedPtr<FJointGraphNodeClassNode>& SubNode : Node->SubNodes)
+	{
+		RemoveClassNodeFromMap(SubNode);
+	}
+}
+
+void FJointGraphNodeClassHelper::ResetGatheredClasses()
+{
+	GatheredClasses.Reset();
 }
 
 void FJointGraphNodeClassHelper::AddClassGraphChildren(TSharedPtr<FJointGraphNodeClassNode> Node,
@@ -1,7 +1,10 @@
 //Copyright 2022~2024 DevGrain. All Rights Reserved.
 
 #include "EditorTools/SJointBulkSearchReplace.h"
+#include "JointEditor.h"
 #include "JointEditorStyle.h"
+#include "JointManager.h"
+#include "JointAssetSweep.h"
 #include "Builder/JointTreeBuilder.h"
 #include "EditorWidget/SJointList.h"
 #include "Widgets/SBoxPanel.h"
@@ -12,8 +15,14 @@
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Misc/MessageDialog.h"
 #include "Slate/SJointManagerViewer.h"
+#include "SearchTree/Index/JointSearchIndex.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Widgets/Docking/SDockTab.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Notifications/SNotificationList.h"
 
 
 /**
@@ -187,6 +196,29 @@ TSharedRef<SWidget> SJointBulkSearchReplace::MakeToolbar()
 	FToolBarBuilder ToolbarBuilder(MakeShareable(new FUICommandList), FMultiBoxCustomization::None);
 	ToolbarBuilder.BeginSection("Main");
 
+	ToolbarBuilder.AddWidget(
+		SNew(SBox)
+		.MinDesiredWidth(400)
+		.VAlign(VAlign_Center)
+		.Padding(FJointEditorStyle::Margin_Normal)
+		[
+			SNew(SSearchBox)
+			.HintText(LOCTEXT("ProjectSearchHintText", "Search all Joint assets..."))
+			.ToolTipText(LOCTEXT("ProjectSearchToolTipText", "Search the query through every Joint manager in the project. Only the assets that may match the query will be loaded and shown on the tree."))
+			.OnTextCommitted(this, &SJointBulkSearchReplace::OnProjectSearchTextCommitted)
+		]);
+
+	ToolbarBuilder.AddWidget(
+		SNew(SBox)
+		.VAlign(VAlign_Center)
+		.Padding(FJointEditorStyle::Margin_Normal)
+		[
+			SNew(SButton)
+			.Text(LOCTEXT("UpdateSearchIndexButtonText", "Update Search Index"))
+			.ToolTipText(LOCTEXT("UpdateSearchIndexButtonToolTipText", "Index the Joint managers that have been changed since they were indexed (e.g. by the source control), so the project search can skip them without loading."))
+			.OnClicked(this, &SJointBulkSearchReplace::OnUpdateSearchIndexButtonPressed)
+		]);
+
 	ToolbarBuilder.EndSection();
 
 	return ToolbarBuilder.MakeWidget();
@@ -246,4 +278,137 @@ void SJointBulkSearchReplace::OnJointListAssetSelected(const FAssetData& AssetDa
 	JointTree->RequestTreeRebuild();
 }
 
+void SJointBulkSearchReplace::OnProjectSearchTextCommitted(const FText& Text, ETextCommit::Type Arg)
+{
+	if (Arg != ETextCommit::OnEnter || Text.IsEmpty()) return;
+
+	FJointEditorModule* EditorModule = FJointEditorModule::Get();
+
+	const TSharedPtr<FJointSearchIndex> SearchIndex = EditorModule ? EditorModule->GetSearchIndex() : nullptr;
+
+	if (!SearchIndex.IsValid()) return;
+
+	const FString Query = Text.ToString();
+
+	TArray<FAssetData> Assets;
+
+	FJointAssetSweep::GetAssetsOfClass(UJointManager::StaticClass(), Assets);
+
+	TArray<FAssetData> Candidates;
+
+	SearchIndex->Query(Query, Assets, Candidates);
+
+	//Keep the matched managers alive until the sweep is finished - the sweep releases the loaded assets as it goes.
+	const TSharedRef<TArray<TStrongObjectPtr<UJointManager>>> Matches = MakeShared<TArray<TStrongObjectPtr<UJointManager>>>();
+
+	const TSharedRef<FJointAssetSweep> Sweep = MakeShared<FJointAssetSweep>(LOCTEXT("ProjectSearchSweepName", "Searching Joint Assets"), Candidates);
+
+	Sweep->ProcessAsset = [SearchIndex, Query, Matches](UObject* Asset, const FAssetData& Data)
+	{
+		UJointManager* Manager = Cast<UJointManager>(Asset);
+
+		if (Manager == nullptr) return;
+
+		//The candidates that were not indexed could be anything - index them now and test them again.
+		if (!SearchIndex->IsUpToDate(Data))
+		{
+			SearchIndex->IndexJointManager(Manager);
+
+			TArray<FAssetData> Candidate;
+
+			SearchIndex->Query(Query, {Data}, Candidate);
+
+			if (Candidate.IsEmpty()) return;
+		}
+
+		Matches->Add(TStrongObjectPtr<UJointManager>(Manager));
+	};
+
+	Sweep->OnFinished = [this, SearchIndex, Text, Matches, NumAssets = Assets.Num()](const FJointAssetSweep& FinishedSweep)
+	{
+		SearchIndex->SaveIfDirty();
+
+		TArray<TWeakObjectPtr<UJointManager>> Managers;
+
+		for (const TStrongObjectPtr<UJointManager>& Match : *Matches)
+		{
+			Managers.Add(Match.Get());
+		}
+
+		JointTree->SetTargetManager(Managers);
+
+		if (JointTree->SearchSearchBox.IsValid()) JointTree->SearchSearchBox->SetText(Text);
+
+		JointTree->OnFilterTextCommitted(Text, ETextCommit::OnEnter);
+		JointTree->RequestTreeRebuild();
+
+		FNotificationInfo Info(
+			FText::Format(
+				LOCTEXT("ProjectSearchFinished", "Found {0} Joint assets that may match the query out of {1}."),
+				FText::AsNumber(Managers.Num()),
+				FText::AsNumber(NumAssets))
+		);
+		Info.ExpireDuration = 3.0f;
+		Info.bFireAndForget = true;
+
+		FSlateNotificationManager::Get().AddNotification(Info);
+	};
+
+	FJointAssetSweep::StartOnWidget(SharedThis(this), ActiveSweep, Sweep);
+}
+
+FReply SJointBulkSearchReplace::OnUpdateSearchIndexButtonPressed()
+{
+	FJointEditorModule* EditorModule = FJointEditorModule::Get();
+
+	const TSharedPtr<FJointSearchIndex> SearchIndex = EditorModule ? EditorModule->GetSearchIndex() : nullptr;
+
+	if (!SearchIndex.IsValid()) return FReply::Handled();
+
+	SearchIndex->Load();
+
+	TArray<FAssetData> Assets;
+
+	FJointAssetSweep::GetAssetsOfClass(UJointManager::StaticClass(), Assets);
+
+	const TSharedRef<int32> Count = MakeShared<int32>(0);
+
+	const TSharedRef<FJointAssetSweep> Sweep = MakeShared<FJointAssetSweep>(LOCTEXT("UpdateSearchIndexSweepName", "Indexing Joint Assets"), Assets);
+
+	Sweep->AssetFilter = [SearchIndex](const FAssetData& Data)
+	{
+		return !SearchIndex->IsUpToDate(Data);
+	};
+
+	Sweep->ProcessAsset = [SearchIndex, Count](UObject* Asset, const FAssetData& Data)
+	{
+		if (const UJointManager* Manager = Cast<UJointManager>(Asset))
+		{
+			SearchIndex->IndexJointManager(Manager);
+
+			++Count.Get();
+		}
+	};
+
+	Sweep->OnFinished = [SearchIndex, Count](const FJointAssetSweep& FinishedSweep)
+	{
+		SearchIndex->SaveIfDirty();
+
+		FNotificationInfo Info(
+			FText::Format(
+				LOCTEXT("UpdatedSearchIndex", "Indexed {0} Joint assets. {1} Joint assets were up to date."),
+				FText::AsNumber(Count.Get()),
+				FText::AsNumber(FinishedSweep.GetNumSkipped()))
+		);
+		Info.ExpireDuration = 3.0f;
+		Info.bFireAndForget = true;
+
+		FSlateNotificationManager::Get().AddNotification(Info);
+	};
+
+	FJointAssetSweep::StartOnWidget(SharedThis(this), ActiveSweep, Sweep);
+
+	return FReply::Handled();
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -16,7 +16,9 @@
 #include "ConnectionDrawingPolicy.h"
 
 #include "GraphDiffControl.h"
+#include "JointEdGraphNode.h"
 #include "JointEdGraphSchema.h"
+#include "GraphNode/SJointGraphNodeBase.h"
 #include "JointEditorSettings.h"
 #include "JointEditorStyle.h"
 
@@ -88,6 +90,8 @@ namespace JointNodePanelDefs
 	static const float GuardBandArea = 0.10f;
 	// Scaling factor to reduce speed of mouse zooming
 	static const float MouseZoomScaling = 0.01f;
+	// The maximum number of nodes that build their deferred sub node slates in a tick - zooming into a large graph shouldn't freeze the editor.
+	static const int32 MaxNodeRealizationsPerTick = 16;
 };
 
 
@@ -1374,6 +1378,40 @@ int32 SJointGraphPanel::OnPaint(const FPaintArgs& Args, const FGeometry& Allotte
 	return MaxLayerId;
 }
 
+void SJointGraphPanel::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SGraphPanel::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	RealizeVisibleNodes(AllottedGeometry);
+}
+
+void SJointGraphPanel::RealizeVisibleNodes(const FGeometry& AllottedGeometry)
+{
+	if (!SJointGraphNodeBase::IsZoomBasedLODEnabled() || SJointGraphNodeBase::ShouldShowLODProxyOn(GetCurrentLOD())) return;
+
+	int32 NumRealized = 0;
+
+	for (int32 ChildIndex = 0; ChildIndex < Children.Num() && NumRealized < JointNodePanelDefs::MaxNodeRealizationsPerTick; ++ChildIndex)
+	{
+		const TSharedRef<SNode>& ChildNode = Children[ChildIndex];
+
+		const UJointEdGraphNode* CastedGraphNode = Cast<UJointEdGraphNode>(ChildNode->GetObjectBeingDisplayed());
+
+		if (CastedGraphNode == nullptr) continue;
+
+		const TSharedPtr<SJointGraphNodeBase> NodeSlate = CastedGraphNode->GetGraphNodeSlate().Pin();
+
+		//The editor node can have slates on the other panels as well (e.g. the previewers) - only take the one on this panel.
+		if (!NodeSlate.IsValid() || static_cast<const SWidget*>(NodeSlate.Get()) != static_cast<const SWidget*>(&ChildNode.Get())) continue;
+
+		if (!NodeSlate->HasDeferredSubNodeSlates() || IsNodeCulled(ChildNode, AllottedGeometry)) continue;
+
+		NodeSlate->RealizeDeferredSubNodeSlates();
+
+		++NumRealized;
+	}
+}
+
 void SJointGraphPanel::SetAllowContinousZoomInterpolation(bool bAllow)
 {
 	bAllowContinousZoomInterpolation = bAllow;
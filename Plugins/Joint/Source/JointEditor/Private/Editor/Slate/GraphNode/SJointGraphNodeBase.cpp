@@ -423,10 +423,23 @@ void SJointGraphNodeBase::PopulateNodeSlates()
 		.VAlign(VAlign_Fill)
 		.Padding(ContentPadding)
 		[
-			CreateCenterWholeBox()
+			SNew(SBox)
+			.Visibility(this, &SJointGraphNodeBase::GetDetailContentVisibility)
+			[
+				CreateCenterWholeBox()
+			]
+		]
+		+ SOverlay::Slot()
+		.HAlign(HAlign_Center)
+		.VAlign(VAlign_Center)
+		.Padding(ContentPadding)
+		[
+			CreateLODProxy()
 		]
 	);
 
+	bHasLODProxy = true;
+
 
 	//Set the color value to the current value.
 	PlayNodeBackgroundColorResetAnimationIfPossible(true);
@@ -697,7 +710,17 @@ FVector2D SJointGraphNodeBase::ComputeDesiredSize(float) const
 	{
 		if (CastedGraphNode->GetUseFixedNodeSize()) return CastedGraphNode->GetSize();
 
-		return SNodePanel::SNode::ComputeDesiredSize(1);
+		if (IsShowingLODProxy())
+		{
+			//Keep the size of the detail zoom. If the node has never been shown in detail zoom, the proxy is all we can measure.
+			return !CachedDetailDesiredSize.IsZero()
+				       ? CachedDetailDesiredSize
+				       : FVector2D(SNodePanel::SNode::ComputeDesiredSize(1)).ComponentMax(GetNodeMinimumSize());
+		}
+
+		CachedDetailDesiredSize = SNodePanel::SNode::ComputeDesiredSize(1);
+
+		return CachedDetailDesiredSize;
 	}
 
 	if (GraphNode)
@@ -739,8 +762,15 @@ void SJointGraphNodeBase::UpdateGraphNode()
 	//Generate pins for this node.
 	PopulatePinWidgets();
 
-	//Generate sub node slates for this node.
-	PopulateSubNodeSlates();
+	//Generate sub node slates for this node. They can be deferred until the node becomes visible in detail zoom. See RealizeDeferredSubNodeSlates().
+	if (ShouldDeferSubNodeSlates())
+	{
+		bHasDeferredSubNodeSlates = true;
+	}
+	else
+	{
+		PopulateSubNodeSlates();
+	}
 
 	UserSize = ComputeDesiredSize(1);
 
@@ -781,6 +811,12 @@ void SJointGraphNodeBase::SetOwner(const TSharedRef<SGraphPanel>& OwnerPanel)
 
 	SGraphNode::SetOwner(OwnerPanel);
 
+	//Only the Joint graph panel realizes the deferred sub node slates. Don't leave them unbuilt on the other panels (e.g. the diff view).
+	if (bHasDeferredSubNodeSlates && OwnerPanel->GetType() != FName("SJointGraphPanel"))
+	{
+		RealizeDeferredSubNodeSlates();
+	}
+
 	for (TSharedPtr<SGraphNode> InGraphNode : SubNodes)
 	{
 		if (!InGraphNode->GetOwnerPanel().IsValid())
@@ -807,6 +843,9 @@ BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void SJointGraphNodeBase::PopulateSubNodeSlates()
 {
+	bHasDeferredSubNodeSlates = false;
+	bHasRealizedSubNodeSlates = true;
+
 	ClearChildrenOnSubNodePanel();
 
 	UJointEdGraphNode* CastedGraphNode = GetCastedGraphNode();
@@ -2030,6 +2069,72 @@ const EJointEdSlateDetailLevel::Type SJointGraphNodeBase::GetSlateDetailLevel()
 	return EJointEdSlateDetailLevel::SlateDetailLevel_Maximum;
 }
 
+bool SJointGraphNodeBase::IsZoomBasedLODEnabled()
+{
+	const UJointEditorSettings* Settings = UJointEditorSettings::Get();
+
+	return Settings && Settings->bUseZoomBasedNodeLOD;
+}
+
+bool SJointGraphNodeBase::ShouldShowLODProxyOn(const EGraphRenderingLOD::Type LOD)
+{
+	return LOD <= EGraphRenderingLOD::LowDetail;
+}
+
+bool SJointGraphNodeBase::IsShowingLODProxy() const
+{
+	//The sub nodes are shown (or hidden) by their parent node.
+	if (!bHasLODProxy || IsSubNodeWidget() || !GetOwnerPanel().IsValid()) return false;
+
+	return IsZoomBasedLODEnabled() && ShouldShowLODProxyOn(GetCurrentLOD());
+}
+
+bool SJointGraphNodeBase::HasDeferredSubNodeSlates() const
+{
+	return bHasDeferredSubNodeSlates;
+}
+
+void SJointGraphNodeBase::RealizeDeferredSubNodeSlates()
+{
+	if (!bHasDeferredSubNodeSlates) return;
+
+	bHasDeferredSubNodeSlates = false;
+	bHasRealizedSubNodeSlates = true;
+
+	PopulateSubNodeSlates();
+
+	UserSize = ComputeDesiredSize(1);
+}
+
+bool SJointGraphNodeBase::ShouldDeferSubNodeSlates() const
+{
+	//Once the node has been shown in detail zoom, keep its sub node slates up to date as usual.
+	if (bHasRealizedSubNodeSlates || IsSubNodeWidget() || !IsZoomBasedLODEnabled()) return false;
+
+	const UJointEdGraphNode* CastedGraphNode = GetCastedGraphNode();
+
+	return CastedGraphNode && !CastedGraphNode->SubNodes.IsEmpty();
+}
+
+TSharedRef<SWidget> SJointGraphNodeBase::CreateLODProxy()
+{
+	return SNew(STextBlock)
+		.Visibility(this, &SJointGraphNodeBase::GetLODProxyVisibility)
+		.Text(this, &SJointGraphNodeBase::GetGraphNodeName)
+		.TextStyle(FJointEditorStyle::Get(), "JointUI.TextBlock.Black.h4")
+		.Justification(ETextJustify::Center);
+}
+
+EVisibility SJointGraphNodeBase::GetDetailContentVisibility() const
+{
+	return IsShowingLODProxy() ? EVisibility::Collapsed : EVisibility::SelfHitTestInvisible;
+}
+
+EVisibility SJointGraphNodeBase::GetLODProxyVisibility() const
+{
+	return IsShowingLODProxy() ? EVisibility::HitTestInvisible : EVisibility::Collapsed;
+}
+
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 TSharedRef<SWidget> SJointGraphNodeBase::CreateCenterContentBox()
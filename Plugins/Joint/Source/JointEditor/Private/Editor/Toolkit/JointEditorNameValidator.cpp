@@ -213,15 +213,15 @@ EValidatorResult FJointEditorNameValidator::Validate(const FName& InName, FText&
 			if (Cast<UJointManager>(Outer)->GetJointGraphAs())
 			{
 
-				TArray<UJointEdGraph*> Graphs = UJointEdGraph::GetAllGraphsFrom(Cast<UJointManager>(Outer));
+				const TArray<UJointEdGraph*>& Graphs = UJointEdGraph::GetCachedGraphsFrom(Cast<UJointManager>(Outer));
 
 				for (UJointEdGraph* JointEdGraph : Graphs) {
 
 					if (!JointEdGraph) continue;
 					
-					TSet<TWeakObjectPtr<UJointEdGraphNode>> Nodes = JointEdGraph->GetCachedJointGraphNodes(true);
+					const TSet<TWeakObjectPtr<UJointEdGraphNode>>& Nodes = JointEdGraph->GetCachedJointGraphNodes();
 
-					for (TWeakObjectPtr<UJointEdGraphNode> JointEdGraphNode : Nodes)
+					for (const TWeakObjectPtr<UJointEdGraphNode>& JointEdGraphNode : Nodes)
 					{
 						if (JointEdGraphNode.IsValid())
 						{
@@ -1092,7 +1092,7 @@ bool FJointEditorToolkit::IsGraphInCurrentJointManager(UEdGraph* Graph)
 {
 	if (Graph == nullptr) return false;
 
-	return UJointEdGraph::GetAllGraphsFrom(GetJointManager()).Contains(Graph);
+	return UJointEdGraph::GetCachedGraphsFrom(GetJointManager()).Contains(Graph);
 }
 
 void FJointEditorToolkit::CreateNewRootGraphForJointManagerIfNeeded() const
@@ -1331,7 +1331,9 @@ void FJointEditorToolkit::CompileAllJointGraphs()
 	if (UJointEdGraph* MainGraph = GetMainJointGraph())
 	{
 		MainGraph->CompileResultPtr->ClearMessages();
-		MainGraph->CompileAllJointGraphFromRoot();
+
+		//Manual compilation - don't trust the compile result caches of the nodes.
+		MainGraph->CompileAllJointGraphFromRoot(true);
 	}
 
 	//Make it display the tab whenever users manually pressed the button.
@@ -1399,14 +1401,15 @@ void FJointEditorToolkit::OnCompileJointGraphFinished(
 		TSharedRef<FTokenizedMessage> Token = FTokenizedMessage::Create(
 			EMessageSeverity::Info,
 			FText::Format(LOCTEXT("CompileFinished",
-								  "Compilation finished. [{0}] {1} Fatal Issue(s) {2} Warning(s) {3} Info. (Compiled through {4} nodes total, {5}ms elapsed on the compilation.)")
+								  "Compilation finished. [{0}] {1} Fatal Issue(s) {2} Warning(s) {3} Info. (Compiled through {4} nodes total, {6} of them recompiled, {5}ms elapsed on the compilation.)")
 						  , FText::FromString(GetJointManager()->GetPathName())
 						  , NumError
 
 						  , NumWarning + NumPerformanceWarning
 						  , NumInfo
 						  , CompileInfo.NodeCount
-						  , CompileInfo.ElapsedTime)
+						  , CompileInfo.ElapsedTime
+						  , CompileInfo.CompiledNodeCount)
 		);
 
 		WeakCompileResultPtr.Pin()->AddMessage(Token);
@@ -1846,6 +1849,9 @@ void FJointEditorToolkit::MoveNodesToGraph(TArray<TObjectPtr<class UEdGraphNode>
 		{
 			OriginalGraph->SubGraphs.Remove(Composite->BoundGraph);
 			DestinationGraph->SubGraphs.Add(Composite->BoundGraph);
+
+			if (UJointEdGraph* CastedOriginalGraph = Cast<UJointEdGraph>(OriginalGraph)) CastedOriginalGraph->NotifyGraphHierarchyChanged();
+			if (UJointEdGraph* CastedDestinationGraph = Cast<UJointEdGraph>(DestinationGraph)) CastedDestinationGraph->NotifyGraphHierarchyChanged();
 		}
 
 		// Want to test exactly against tunnel, we shouldn't collapse embedded collapsed
@@ -1902,6 +1908,9 @@ void FJointEditorToolkit::ExpandNode(UEdGraphNode* InNodeToExpand, UEdGraph* InS
 	{
 		DestinationGraph->SubGraphs.Append(SourceGraph->SubGraphs);
 		SourceGraph->SubGraphs.Empty();
+
+		if (UJointEdGraph* CastedSourceGraph = Cast<UJointEdGraph>(SourceGraph)) CastedSourceGraph->NotifyGraphHierarchyChanged();
+		if (UJointEdGraph* CastedDestinationGraph = Cast<UJointEdGraph>(DestinationGraph)) CastedDestinationGraph->NotifyGraphHierarchyChanged();
 	}
 
 	// Fix up the outer for all of the nodes that were moved
@@ -2034,6 +2043,9 @@ void FJointEditorToolkit::CollapseNodesIntoGraph(UJointEdGraphNode_Composite* In
 		{
 			InSourceGraph->SubGraphs.Remove(Composite->BoundGraph);
 			InDestinationGraph->SubGraphs.Add(Composite->BoundGraph);
+
+			if (UJointEdGraph* CastedSourceGraph = Cast<UJointEdGraph>(InSourceGraph)) CastedSourceGraph->NotifyGraphHierarchyChanged();
+			if (UJointEdGraph* CastedDestinationGraph = Cast<UJointEdGraph>(InDestinationGraph)) CastedDestinationGraph->NotifyGraphHierarchyChanged();
 		}
 
 		// Find cross-graph links
@@ -3037,10 +3049,8 @@ void FJointEditorToolkit::CopySelectedNodes()
 	
 	
 	// Remove the nodes that are contained within other selected nodes - we only want to copy the top-level nodes
-	for (int i = NodesToCopy.Num() - 1; i >= 0; --i)
+	for (UObject* NodeToCheck : NodesToCopy.Array())
 	{
-		UObject* NodeToCheck = NodesToCopy.Array()[i];
-
 		if (UJointEdGraphNode* CastedNode = Cast<UJointEdGraphNode>(NodeToCheck))
 		{
 			for (UJointEdGraphNode* SubNode : CastedNode->GetAllSubNodesInHierarchy())
@@ -3192,11 +3202,23 @@ void FJointEditorToolkit::PasteNodesHere(const FVector2D& Location)
 		}
 	}
 
-	// Start to do actual paste operation - make a transaction for undo/redo
+	// Start to do actual paste operation - make a single transaction for undo/redo
 	const FScopedTransaction Transaction(FGenericCommands::Get().Paste->GetDescription());
 
 	CastedGraph->Modify();
+
+	// Record the attach target before the pasted fragments are attached to it.
+	if (AttachTargetNode)
+	{
+		AttachTargetNode->Modify();
+
+		if (AttachTargetNode->GetCastedNodeInstance()) AttachTargetNode->GetCastedNodeInstance()->Modify();
+	}
+
 	CastedGraph->LockUpdates();
+
+	// Hold the graph change notifications until the paste is done, so the graph editor creates the slates of the pasted nodes at once instead of one by one as they are imported.
+	CastedGraph->BeginBulkEdit();
 	
 	// Clear the selection set (newly pasted stuff will be selected)
 	CurrentGraphEditor->ClearSelectionSet();
@@ -3210,21 +3232,23 @@ void FJointEditorToolkit::PasteNodesHere(const FVector2D& Location)
 	TSet<UEdGraphNode*> PastedNodes;
 
 	FEdGraphUtilities::ImportNodesFromText(CastedGraph, TextToImport, PastedNodes);
+
+	// Record the pasted nodes on the transaction before they are moved, renamed and reattached, and handle any fixup of the imported nodes.
+	FJointEdUtils::MarkNodesAsModifiedAndValidateName(PastedNodes);
 	
 	// Move the pasted nodes to the location of the paste request
 	FJointEdUtils::MoveNodesAtLocation(PastedNodes, Location);
-	
-	// Handle any fixup of the imported nodes
-	FJointEdUtils::MarkNodesAsModifiedAndValidateName(PastedNodes);
+
+	// Let the pasted nodes refer to each other rather than the nodes they have been copied from.
+	FJointEdUtils::RemapNodePointersOfPastedNodes(PastedNodes);
+
+	// The nodes that have been attached to the selected node. Only these have to be processed again after the import.
+	TSet<UEdGraphNode*> ReattachedNodes;
 	
 	// See if the newly pasted nodes can be attached to the selected node on the graph.
 	// if it's a node that had a parent node when it was copied, and we have a valid attach target node, then attach it to the target node.
 	if (AttachTargetNode)
 	{
-		AttachTargetNode->Modify();
-
-		if (AttachTargetNode->GetCastedNodeInstance()) AttachTargetNode->GetCastedNodeInstance()->Modify();
-
 		for (UEdGraphNode* InEdGraphNode : PastedNodes)
 		{
 			if (InEdGraphNode == nullptr) continue;
@@ -3232,12 +3256,18 @@ void FJointEditorToolkit::PasteNodesHere(const FVector2D& Location)
 			if (UJointEdGraphNode_Fragment* CastedPastedNode = Cast<UJointEdGraphNode_Fragment>(InEdGraphNode))
 			{
 				CastedPastedNode->ParentNode = AttachTargetNode;
-				AttachTargetNode->AddSubNode(CastedPastedNode);
+
+				// Update the target node once after all the fragments have been attached.
+				AttachTargetNode->AddSubNode(CastedPastedNode, true);
 
 				// Remove the Paste Node from the graph.
 				CastedGraph->RemoveNode(CastedPastedNode);
+
+				ReattachedNodes.Add(CastedPastedNode);
 			}
 		}
+
+		if (ReattachedNodes.Num() > 0) AttachTargetNode->Update();
 	}else
 	{
 		for (UEdGraphNode* InEdGraphNode : PastedNodes)
@@ -3251,19 +3281,15 @@ void FJointEditorToolkit::PasteNodesHere(const FVector2D& Location)
 		}
 	}
 	
-	// Explicitly call PostProcessPastedNodes on the pasted nodes one more time since we modified attachment. (FEdGraphUtilities::ImportNodesFromText already called it once)
-	FEdGraphUtilities::PostProcessPastedNodes(PastedNodes);
+	// Call PostProcessPastedNodes one more time on the nodes whose attachment has been modified. (FEdGraphUtilities::ImportNodesFromText already called it once for all the pasted nodes)
+	if (ReattachedNodes.Num() > 0) FEdGraphUtilities::PostProcessPastedNodes(ReattachedNodes);
 	
 	// Notify the graph that graph nodes have been pasted.
-	if (CastedGraph)
-	{
-		CastedGraph->OnNodesPasted(TextToImport);
-		CastedGraph->UnlockUpdates();
-		CastedGraph->NotifyGraphChanged();
-	}
+	CastedGraph->OnNodesPasted(TextToImport);
+	CastedGraph->UnlockUpdates();
 
-	// Update UI
-	CurrentGraphEditor->NotifyGraphChanged();
+	// Notify the graph (and the graph editors) once for the whole paste.
+	CastedGraph->EndBulkEdit();
 
 	// Mark the package as dirty
 	UObject* GraphOwner = CastedGraph->GetOuter();
@@ -3622,7 +3648,7 @@ void FJointEditorToolkit::OnRemoveAllBreakpoints()
 
 bool FJointEditorToolkit::CanRemoveAllBreakpoints() const
 {
-	TArray<UJointEdGraph*> Graphs = UJointEdGraph::GetAllGraphsFrom(GetJointManager());
+	const TArray<UJointEdGraph*>& Graphs = UJointEdGraph::GetCachedGraphsFrom(GetJointManager());
 
 	for (UJointEdGraph* Graph : Graphs)
 	{
@@ -3654,7 +3680,7 @@ void FJointEditorToolkit::OnEnableAllBreakpoints()
 
 bool FJointEditorToolkit::CanEnableAllBreakpoints() const
 {
-	TArray<UJointEdGraph*> Graphs = UJointEdGraph::GetAllGraphsFrom(GetJointManager());
+	const TArray<UJointEdGraph*>& Graphs = UJointEdGraph::GetCachedGraphsFrom(GetJointManager());
 
 	for (UJointEdGraph* Graph : Graphs)
 	{
@@ -3691,7 +3717,7 @@ void FJointEditorToolkit::OnDisableAllBreakpoints()
 
 bool FJointEditorToolkit::CanDisableAllBreakpoints() const
 {
-	TArray<UJointEdGraph*> Graphs = UJointEdGraph::GetAllGraphsFrom(GetJointManager());
+	const TArray<UJointEdGraph*>& Graphs = UJointEdGraph::GetCachedGraphsFrom(GetJointManager());
 
 	for (UJointEdGraph* Graph : Graphs)
 	{
@@ -14,6 +14,8 @@
 #include "JointGraphNodeSlateFactory.h"
 
 #include "EdGraphUtilities.h"
+#include "Joint.h"
+#include "JointEdUtils.h"
 #include "ISequencerModule.h"
 #include "JointBuildPresetActions.h"
 #include "JointEditorSettings.h"
@@ -23,6 +25,7 @@
 
 #include "Debug/JointDebugger.h"
 #include "EditorTools/SJointBulkSearchReplace.h"
+#include "SearchTree/Index/JointSearchIndex.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Node/JointFragment.h"
 #include "SharedType/JointSharedTypes.h"
@@ -79,6 +82,10 @@ void FJointEditorModule::StartupModule()
 
 	RegisterDebugger();
 
+	RegisterAssetRegistryTagGatherer();
+
+	SearchIndex = MakeShareable(new FJointSearchIndex);
+
 	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(JointToolTabNames::JointManagementTab,
 	                                                  FOnSpawnTab::CreateRaw(
 		                                                  this, &FJointEditorModule::OnSpawnJointManagementTab))
@@ -111,6 +118,7 @@ void FJointEditorModule::ShutdownModule()
 	UnregisterSequencerTrack();
 	UnregisterClassLayout();
 	UnregisterDebugger();
+	UnregisterAssetRegistryTagGatherer();
 
 	FEdGraphUtilities::UnregisterVisualNodeFactory(JointNodeStyleFactory);
 	FEdGraphUtilities::UnregisterVisualPinFactory(JointGraphPinFactory);
@@ -125,6 +133,10 @@ void FJointEditorModule::ShutdownModule()
 	JointNodeStyleFactory.Reset();
 	JointGraphPinFactory.Reset();
 	JointManagementTabHandler.Reset();
+
+	if (SearchIndex.IsValid()) SearchIndex->SaveIfDirty();
+
+	SearchIndex.Reset();
 }
 
 bool FJointEditorModule::SupportsDynamicReloading()
@@ -430,6 +442,27 @@ void FJointEditorModule::UnregisterDebugger()
 	}
 }
 
+void FJointEditorModule::RegisterAssetRegistryTagGatherer()
+{
+	if (FJointModule* Module = FModuleManager::GetModulePtr<FJointModule>("Joint"))
+	{
+		Module->OnGatherEditorAssetRegistryTags.BindStatic(&FJointEdUtils::GatherEditorAssetRegistryTags);
+	}
+}
+
+void FJointEditorModule::UnregisterAssetRegistryTagGatherer()
+{
+	if (FJointModule* Module = FModuleManager::GetModulePtr<FJointModule>("Joint"))
+	{
+		Module->OnGatherEditorAssetRegistryTags.Unbind();
+	}
+}
+
+TSharedPtr<FJointSearchIndex> FJointEditorModule::GetSearchIndex()
+{
+	return SearchIndex;
+}
+
 TSharedPtr<FJointGraphNodeClassHelper> FJointEditorModule::GetEdClassCache()
 {
 	return EdClassCache;
@@ -14,6 +14,7 @@
 #include "JointEditorSettings.h"
 #include "JointEditorToolkit.h"
 #include "JointEdUtils.h"
+#include "JointAssetSweep.h"
 #include "ScopedTransaction.h"
 
 #include "Node/JointNodeBase.h"
@@ -31,6 +32,7 @@
 
 #include "Math/UnrealMathUtility.h"
 #include "Misc/UObjectToken.h"
+#include "UObject/ObjectKey.h"
 
 #include "Logging/TokenizedMessage.h"
 #include "Misc/EngineVersionComparison.h"
@@ -984,12 +986,19 @@ void UJointEdGraphNode::PostPasteNode()
 	
 	UpdateNodeInstance();
 
+	MarkCompileContentDirty(false);
+
 	//Since it has been allocated in different location, refresh the connection.
 	NodeConnectionListChanged();
 }
 
 void UJointEdGraphNode::PostEditImport()
 {
+	if (const UJointNodeBase* CastedNodeInstance = GetCastedNodeInstance())
+	{
+		CopiedNodeInstanceGuid = CastedNodeInstance->NodeGuid;
+	}
+
 	CreateNewGuid();
 
 	ReallocateNodeInstanceGuid();
@@ -1003,9 +1012,19 @@ void UJointEdGraphNode::PostEditUndo()
 {
 	UpdateNodeInstance();
 
+	MarkCompileContentDirty(false);
+
 	return Super::PostEditUndo();
 }
 
+void UJointEdGraphNode::PinConnectionListChanged(UEdGraphPin* Pin)
+{
+	Super::PinConnectionListChanged(Pin);
+
+	//Both ends of the connection get this call, so there is no need to propagate it.
+	MarkCompileContentDirty(false);
+}
+
 void UJointEdGraphNode::DestroyNode()
 {
 	UnbindNodeInstance();
@@ -1272,6 +1291,11 @@ void UJointEdGraphNode::AddSubNode(UJointEdGraphNode* SubNode, const bool bIsUpd
 
 	SubNodes.Add(SubNode);
 
+	MarkCompileContentDirty();
+
+	//The graph caches include the sub nodes, but attaching one is not a graph action.
+	if (UJointEdGraph* Graph = GetCastedGraph()) Graph->RecacheNodes();
+
 	SubNode->UpdatePins();
 	SubNode->AutowireNewNode(nullptr);
 
@@ -1312,6 +1336,8 @@ void UJointEdGraphNode::SetParentNodeTo(UJointEdGraphNode* NewParentNode)
 		if (GetCastedNodeInstance()) GetCastedNodeInstance()->ParentNode = nullptr;
 	}
 
+	MarkCompileContentDirty(false);
+
 	RecalculateNodeDepth();
 }
 
@@ -1356,6 +1382,10 @@ void UJointEdGraphNode::RearrangeSubNodeAt(UJointEdGraphNode* SubNode, int32 Dro
 
 	SubNode->SetParentNodeTo(this);
 
+	MarkCompileContentDirty();
+
+	if (UJointEdGraph* Graph = GetCastedGraph()) Graph->RecacheNodes();
+
 	if (!bIsUpdateLocked) Update();
 }
 
@@ -1369,6 +1399,10 @@ void UJointEdGraphNode::RemoveSubNode(UJointEdGraphNode* SubNode, const bool bIs
 
 	SubNode->SetParentNodeTo(nullptr);
 
+	MarkCompileContentDirty();
+
+	if (UJointEdGraph* Graph = GetCastedGraph()) Graph->RecacheNodes();
+
 	if (!bIsUpdateLocked) Update();
 }
 
@@ -1376,6 +1410,10 @@ void UJointEdGraphNode::RemoveAllSubNodes(bool bIsUpdateLocked = true)
 {
 	SubNodes.Reset();
 
+	MarkCompileContentDirty();
+
+	if (UJointEdGraph* Graph = GetCastedGraph()) Graph->RecacheNodes();
+
 	if (!bIsUpdateLocked) Update();
 }
 
@@ -1643,6 +1681,9 @@ void UJointEdGraphNode::ReconstructNode()
 
 	UpdatePins();
 
+	//Reconstructed on the load of the graph as well - only rehash this node and let the saved compile results be used if nothing changed.
+	MarkCompileContentDirty(false);
+
 	RequestUpdateSlate();
 
 	NodeConnectionListChanged();
@@ -1677,6 +1718,8 @@ void UJointEdGraphNode::OnNodeInstancePropertyChanged(const FPropertyChangedEven
 {
 	UpdatePins();
 
+	MarkCompileContentDirty();
+
 	NotifyNodeInstancePropertyChangeToGraphNodeWidget(PropertyChangedEvent, PropertyName);
 
 	NodeConnectionListChanged();
@@ -1684,6 +1727,8 @@ void UJointEdGraphNode::OnNodeInstancePropertyChanged(const FPropertyChangedEven
 
 void UJointEdGraphNode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
+	MarkCompileContentDirty();
+
 	NotifyGraphNodePropertyChangeToGraphNodeWidget(PropertyChangedEvent);
 	
 	//Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -2052,6 +2097,13 @@ void UJointEdGraphNode::CompileNode(const TSharedPtr<class IMessageLogListing>&
 
 	OnCompileNode();
 
+	CacheCompileResult();
+
+	ReportCompileResult(CompileResultMessage);
+}
+
+void UJointEdGraphNode::ReportCompileResult(const TSharedPtr<IMessageLogListing>& CompileResultMessage)
+{
 	if (CompileResultMessage.IsValid())
 	{
 		for (const TSharedPtr<FTokenizedMessage>& TokenizedMessage : CompileMessages)
@@ -2067,7 +2119,272 @@ void UJointEdGraphNode::CompileNode(const TSharedPtr<class IMessageLogListing>&
 	TSharedPtr<SJointGraphNodeBase> NodeSlate = GetGraphNodeSlate().Pin();
 	
 	NodeSlate->UpdateErrorInfo();
-	
+}
+
+void UJointEdGraphNode::CacheCompileResult()
+{
+	CompiledContentHash = GetCompileContentHash();
+
+	bCompileRequested = false;
+
+	CachedCompileMessages.Reset(CompileMessages.Num());
+
+	for (const TSharedPtr<FTokenizedMessage>& TokenizedMessage : CompileMessages)
+	{
+		if (!TokenizedMessage.IsValid()) continue;
+
+		//Keep only the message itself. The asset and the node link tokens (and the separator after the asset name) are rebuilt on restoration.
+		FString Message;
+
+		bool bSkipNextSeparator = false;
+
+		for (const TSharedRef<IMessageToken>& Token : TokenizedMessage->GetMessageTokens())
+		{
+			const EMessageToken::Type TokenType = Token->GetType();
+
+			if (TokenType == EMessageToken::AssetName)
+			{
+				bSkipNextSeparator = true;
+
+				continue;
+			}
+
+			if (TokenType != EMessageToken::Text && TokenType != EMessageToken::DynamicText) continue;
+
+			const FString TokenString = Token->ToText().ToString();
+
+			if (bSkipNextSeparator)
+			{
+				bSkipNextSeparator = false;
+
+				if (TokenString == TEXT(":")) continue;
+			}
+
+			if (!Message.IsEmpty()) Message += TEXT(" ");
+
+			Message += TokenString;
+		}
+
+		CachedCompileMessages.Emplace(
+			FJointEdUtils::ResolveEMessageSeverityToJointEdMessageSeverity(TokenizedMessage->GetSeverity()),
+			FText::FromString(Message));
+	}
+}
+
+void UJointEdGraphNode::RestoreCompileResult(const TSharedPtr<IMessageLogListing>& CompileResultMessage)
+{
+	//The node hasn't been compiled in this session. Rebuild the messages from the saved ones.
+	if (CompileMessages.IsEmpty() && !CachedCompileMessages.IsEmpty())
+	{
+		for (const FJointEdLogMessage& CachedCompileMessage : CachedCompileMessages)
+		{
+			TSharedRef<FTokenizedMessage> TokenizedMessage = FTokenizedMessage::Create(
+				FJointEdUtils::ResolveJointEdMessageSeverityToEMessageSeverity(CachedCompileMessage.Severity));
+			TokenizedMessage->AddToken(
+				FAssetNameToken::Create(GetJointManager() ? GetJointManager()->GetName() : "NONE"));
+			TokenizedMessage->AddToken(FTextToken::Create(FText::FromString(":")));
+			TokenizedMessage->AddToken(FUObjectToken::Create(this));
+			TokenizedMessage->AddToken(FTextToken::Create(CachedCompileMessage.Message));
+			TokenizedMessage.Get().SetMessageLink(FUObjectToken::Create(this));
+
+			CompileMessages.Add(TokenizedMessage);
+		}
+	}
+
+	ReportCompileResult(CompileResultMessage);
+}
+
+void UJointEdGraphNode::MarkCompileContentDirty(const bool bPropagateToDependents)
+{
+	bCompileContentDirty = true;
+
+	if (!bPropagateToDependents) return;
+
+	//The dependents must be compiled again even if their own content didn't change.
+	if (ParentNode)
+	{
+		ParentNode->bCompileRequested = true;
+	}
+
+	for (const UEdGraphPin* Pin : Pins)
+	{
+		if (Pin == nullptr) continue;
+
+		for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+		{
+			if (LinkedPin == nullptr) continue;
+
+			if (UJointEdGraphNode* LinkedNode = Cast<UJointEdGraphNode>(LinkedPin->GetOwningNodeUnchecked()))
+			{
+				LinkedNode->bCompileRequested = true;
+			}
+		}
+	}
+}
+
+namespace JointEdNodeClassContentHash
+{
+	//Bumped on every reset, so the classes with unsaved changes get a new hash on each compilation.
+	uint32 Generation = 0;
+
+	TMap<FObjectKey, uint32>& GetCache()
+	{
+		static TMap<FObjectKey, uint32> Cache;
+
+		return Cache;
+	}
+
+	uint32 CalculateClassHash(const UClass* InClass)
+	{
+		if (InClass == nullptr) return 0;
+
+		if (const uint32* Found = GetCache().Find(InClass)) return *Found;
+
+		uint32 Hash = FCrc::StrCrc32(*InClass->GetPathName());
+
+		//The blueprint classes (and the blueprint parents) by their saved package. It covers the changes on the graphs of the blueprint as well, such as the compile events.
+		for (const UClass* Class = InClass; Class; Class = Class->GetSuperClass())
+		{
+			if (Class->ClassGeneratedBy == nullptr) continue;
+
+			const FString SavedHash = FJointAssetSweepCache::GetPackageSavedHash(Class->GetOutermost()->GetFName());
+
+			//Unsaved (or never saved) blueprints can't be trusted across the compilations.
+			Hash = SavedHash.IsEmpty()
+				? HashCombine(Hash, Generation)
+				: HashCombine(Hash, FCrc::StrCrc32(*SavedHash));
+		}
+
+		//The property layout and the default values of the class.
+		const UObject* ClassDefaultObject = InClass->GetDefaultObject(false);
+
+		for (TFieldIterator<FProperty> It(InClass); It; ++It)
+		{
+			const FProperty* Property = *It;
+
+			Hash = HashCombine(Hash, FCrc::StrCrc32(*Property->GetName()));
+			Hash = HashCombine(Hash, FCrc::StrCrc32(*Property->GetCPPType()));
+
+			if (ClassDefaultObject == nullptr || Property->HasAnyPropertyFlags(CPF_Transient)) continue;
+
+			FString ExportedValue;
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+			Property->ExportTextItem(ExportedValue, Property->ContainerPtrToValuePtr<uint8>(ClassDefaultObject), nullptr, nullptr, PPF_None, nullptr);
+#else
+			Property->ExportTextItem_Direct(ExportedValue, Property->ContainerPtrToValuePtr<uint8>(ClassDefaultObject), nullptr, nullptr, PPF_None, nullptr);
+#endif
+
+			Hash = HashCombine(Hash, FCrc::StrCrc32(*ExportedValue));
+		}
+
+		GetCache().Add(InClass, Hash);
+
+		return Hash;
+	}
+}
+
+void UJointEdGraphNode::ResetNodeClassContentHashCache()
+{
+	JointEdNodeClassContentHash::GetCache().Reset();
+
+	++JointEdNodeClassContentHash::Generation;
+}
+
+uint32 UJointEdGraphNode::GetCompileContentHash()
+{
+	if (bCompileContentDirty)
+	{
+		CachedContentHash = CalculateCompileContentHash();
+		
+		bCompileContentDirty = false;
+	}
+
+	uint32 Hash = CachedContentHash;
+
+	//The reachability and the class state can change without touching this node, so they are read fresh every time.
+	if (const UJointNodeBase* CastedNodeInstance = GetCastedNodeInstance(); CastedNodeInstance && GetJointManager())
+	{
+		const FJointReachability& Reachability = GetJointManager()->GetReachability();
+
+		const int32 NodeIndex = Reachability.IsValid() ? Reachability.FindNodeIndex(CastedNodeInstance->GetNodeGuid()) : INDEX_NONE;
+
+		const uint32 ReachabilityState = NodeIndex == INDEX_NONE
+			? 0
+			: Reachability.IsReachableFromStart(NodeIndex)
+			? 1
+			: Reachability.IsNodeLive(NodeIndex)
+			? 2
+			: 3;
+
+		Hash = HashCombine(Hash, ReachabilityState);
+	}
+
+	FJointEditorModule& EditorModule = FModuleManager::GetModuleChecked<FJointEditorModule>(TEXT("JointEditor"));
+
+	Hash = HashCombine(Hash, EditorModule.GetClassCache().Get()->IsClassKnown(NodeClassData) ? 1u : 0u);
+
+	if (NodeInstance) Hash = HashCombine(Hash, JointEdNodeClassContentHash::CalculateClassHash(NodeInstance->GetClass()));
+
+	return Hash;
+}
+
+bool UJointEdGraphNode::IsCompileResultUpToDate()
+{
+	return !bCompileRequested && CompiledContentHash != 0 && CompiledContentHash == GetCompileContentHash();
+}
+
+uint32 UJointEdGraphNode::CalculateCompileContentHash() const
+{
+	//Only the stable data (names, paths, exported texts and Guids) is hashed here, since the hash is saved with the asset and compared on the next session.
+	uint32 Hash = FCrc::StrCrc32(*GetPathName());
+
+	Hash = HashCombine(Hash, FCrc::StrCrc32(*NodeClassData.ToString()));
+
+	if (NodeInstance)
+	{
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*NodeInstance->GetClass()->GetPathName()));
+
+		for (TFieldIterator<FProperty> It(NodeInstance->GetClass()); It; ++It)
+		{
+			const FProperty* Property = *It;
+
+			if (Property == nullptr || Property->HasAnyPropertyFlags(CPF_Transient)) continue;
+
+			FString ExportedValue;
+
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+			Property->ExportTextItem(ExportedValue, Property->ContainerPtrToValuePtr<uint8>(NodeInstance), nullptr, nullptr, PPF_None, nullptr);
+#else
+			Property->ExportTextItem_Direct(ExportedValue, Property->ContainerPtrToValuePtr<uint8>(NodeInstance), nullptr, nullptr, PPF_None, nullptr);
+#endif
+
+			Hash = HashCombine(Hash, FCrc::StrCrc32(*ExportedValue));
+		}
+	}
+
+	for (const UEdGraphPin* Pin : Pins)
+	{
+		if (Pin == nullptr) continue;
+
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*Pin->PinName.ToString()));
+
+		for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+		{
+			if (LinkedPin == nullptr || LinkedPin->GetOwningNodeUnchecked() == nullptr) continue;
+
+			Hash = HashCombine(Hash, GetTypeHash(LinkedPin->GetOwningNodeUnchecked()->NodeGuid));
+		}
+	}
+
+	for (const UJointEdGraphNode* SubNode : SubNodes)
+	{
+		if (SubNode == nullptr) continue;
+
+		Hash = HashCombine(Hash, GetTypeHash(SubNode->NodeGuid));
+	}
+
+	return Hash;
 }
 
 void UJointEdGraphNode::OnCompileNode()
@@ -2081,6 +2398,8 @@ void UJointEdGraphNode::OnCompileNode()
 		AttachPropertyCompilerMessage();
 
 		CompileAndAttachNodeInstanceCompilationMessages();
+
+		AttachReachabilityCompilerMessage();
 	}
 	else
 	{
@@ -2297,6 +2616,36 @@ void UJointEdGraphNode::CompileAndAttachNodeInstanceCompilationMessages()
 	}
 }
 
+void UJointEdGraphNode::AttachReachabilityCompilerMessage()
+{
+	UJointNodeBase* CastedNodeInstance = GetCastedNodeInstance();
+
+	//Only the base nodes are analyzed.
+	if (!CastedNodeInstance || CastedNodeInstance->GetParentNode() != nullptr || !GetJointManager()) return;
+
+	const FJointReachability& Reachability = GetJointManager()->GetReachability();
+
+	if (!Reachability.IsValid()) return;
+
+	const int32 NodeIndex = Reachability.FindNodeIndex(CastedNodeInstance->GetNodeGuid());
+
+	if (NodeIndex == INDEX_NONE || Reachability.IsReachableFromStart(NodeIndex)) return;
+
+	const FText Message = Reachability.IsNodeLive(NodeIndex)
+		? LOCTEXT("NodeOnlyReferenced", "This node can not be reached from the start node. It is only used through the node pointers of the other nodes.")
+		: LOCTEXT("NodeUnreachable", "This node can not be reached from the start node and nothing refers to it. It will be stripped from the cooked data if 'Strip Unreachable Nodes On Cook' is enabled on the Joint manager.");
+
+	TSharedRef<FTokenizedMessage> TokenizedMessage = FTokenizedMessage::Create(
+		Reachability.IsNodeLive(NodeIndex) ? EMessageSeverity::Info : EMessageSeverity::Warning);
+	TokenizedMessage->AddToken(FAssetNameToken::Create(GetJointManager()->GetName()));
+	TokenizedMessage->AddToken(FTextToken::Create(FText::FromString(":")));
+	TokenizedMessage->AddToken(FUObjectToken::Create(this));
+	TokenizedMessage->AddToken(FTextToken::Create(Message));
+	TokenizedMessage.Get().SetMessageLink(FUObjectToken::Create(this));
+
+	CompileMessages.Add(TokenizedMessage);
+}
+
 FLinearColor UJointEdGraphNode::GetNodeBodyTintColor() const
 {
 	if (UJointEditorSettings* EdSettings = UJointEditorSettings::Get())
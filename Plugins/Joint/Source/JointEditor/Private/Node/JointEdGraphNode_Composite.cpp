@@ -237,6 +237,7 @@ void UJointEdGraphNode_Composite::PostPasteNode()
 		}
 
 		GetCastedGraph()->SubGraphs.Add(BoundGraph);
+		GetCastedGraph()->NotifyGraphHierarchyChanged();
 
 		if (UJointEdGraph* CastedBoundGraph = Cast<UJointEdGraph>(BoundGraph))
 		{
@@ -309,6 +310,8 @@ void UJointEdGraphNode_Composite::PostPlacedNewNode()
 	// Add the new graph as a child of our parent graph
 	GetGraph()->SubGraphs.Add(BoundGraph);
 
+	if (UJointEdGraph* CastedGraph = GetCastedGraph()) CastedGraph->NotifyGraphHierarchyChanged();
+
 	Super::PostPlacedNewNode();
 }
 
@@ -0,0 +1,40 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "JointTraversalBenchmarkCommandlet.generated.h"
+
+class UJointManager;
+
+/**
+ * A commandlet that measures the runtime cost of the Joint managers in the project.
+ *
+ * It loads every Joint manager found on the asset registry, plays it with a Joint actor in a minimal game world,
+ * and drives it through the graph by itself: the playing base node is ended by force on each step (so the nodes that wait for an input don't block it),
+ * and the next node is picked from the possible next nodes of the playing node (so the branches of the select & condition nodes are taken regardless of their state).
+ *
+ * Writes JointTraversalBenchmark.csv and JointTraversalBenchmark.json to Saved/Joint/Benchmark (or -Output=<Dir>) with a row per asset.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=JointTraversalBenchmark [-Mode=Random|Exhaustive] [-Runs=8] [-MaxSteps=256] [-Seed=0] [-Filter=/Game/Path] [-Output=<Dir>]
+ *
+ * Random : Plays the Joint Runs times, picking a random next node on each step.
+ * Exhaustive : Keeps playing the Joint, picking the least taken branch on each step, until a run doesn't take any new branch or Runs is reached.
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+UCLASS()
+class JOINTEDITOR_API UJointTraversalBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UJointTraversalBenchmarkCommandlet();
+
+public:
+
+	virtual int32 Main(const FString& Params) override;
+
+};
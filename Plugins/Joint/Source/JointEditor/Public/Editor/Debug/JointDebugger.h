@@ -6,6 +6,7 @@
 #include "JointEdGraphNode.h"
 #include "JointNodeDebugData.h"
 #include "SubSystem/JointSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "JointDebugger.generated.h"
 
 class FJointEditorToolkit;
@@ -204,6 +205,13 @@ public:
 	 */
 	void GetMatchingInstances(UJointManager* JointManager, TArray<AJointActor*>& MatchingInstances);
 
+	/**
+	 * Get the known instances that use the provided Joint manager, without copying them.
+	 * @param JointManager Original Joint manager asset to search the instances with.
+	 * @return The instances, or nullptr if there is none.
+	 */
+	const TArray<TWeakObjectPtr<AJointActor>>* FindMatchingInstances(const UJointManager* JointManager) const;
+
 	/**
 	 * Get proper description for the provided Joint instance.
 	 * @param Instance The Joint instance to describe.
@@ -283,6 +291,64 @@ public:
 	static FJointNodeDebugData* GetDebugDataForInstanceFrom(TArray<FJointNodeDebugData>* TargetDataArrayPtr, UJointNodeBase* NodeInstance);
 
 
+public:
+
+	/**
+	 * Find the graph node of the provided Joint manager that holds the node instance with the provided Guid.
+	 * The graph nodes of a Joint manager are indexed by their node Guids on the first look-up of the session, so the debug notifications don't walk the graphs every time.
+	 * @param JointManager The Joint manager to search the graph node from. Can be a transient instance of a Joint actor.
+	 * @param NodeGuid The Guid of the node instance.
+	 * @return found graph node. If not present, returns nullptr.
+	 */
+	UJointEdGraphNode* FindGraphNodeForNodeGuid(UJointManager* JointManager, const FGuid& NodeGuid);
+
+	/**
+	 * Discard the cached look-up data of the provided Joint manager. Must be called whenever its graph gets edited.
+	 * Joint 2.12.0 : Added.
+	 */
+	static void InvalidateDebugLookUpFor(const UJointManager* JointManager);
+
+private:
+
+	void BuildGraphNodeIndexFor(UJointManager* JointManager, TMap<FGuid, TWeakObjectPtr<UJointEdGraphNode>>& OutIndex) const;
+
+	struct FDebugDataIndex
+	{
+		/** The buffer and the size of the array on the build, to tell whether the array has been changed since then. */
+		const FJointNodeDebugData* Data = nullptr;
+
+		int32 Num = 0;
+
+		/** Node instance Guid -> the index of its debug data in the array. */
+		TMap<FGuid, int32> Index;
+	};
+
+	static void BuildDebugDataIndexFor(const TArray<FJointNodeDebugData>& DebugDataArray, FDebugDataIndex& OutIndex);
+
+private:
+
+	//Look-up data of the session. Rebuilt on demand, and discarded when the graphs get edited or the session ends.
+
+	/**
+	 * Joint manager -> (node instance Guid -> graph node).
+	 */
+	TMap<FObjectKey, TMap<FGuid, TWeakObjectPtr<UJointEdGraphNode>>> GraphNodeIndex;
+
+	/**
+	 * Graph -> the graph of the original asset that holds the debug data of it.
+	 */
+	TMap<FObjectKey, TWeakObjectPtr<UJointEdGraph>> DebugDataGraphIndex;
+
+	/**
+	 * Debug data array of a graph -> the index of its debug data by the node instance Guid. Rebuilt when the array gets resized or reallocated.
+	 */
+	TMap<const TArray<FJointNodeDebugData>*, FDebugDataIndex> DebugDataIndex;
+
+	/**
+	 * Original Joint manager -> the known Joint instances that are playing it.
+	 */
+	TMap<FObjectKey, TArray<TWeakObjectPtr<AJointActor>>> KnownInstancesByManager;
+
 public:
 	
 	/** PIE worlds that we can debug */
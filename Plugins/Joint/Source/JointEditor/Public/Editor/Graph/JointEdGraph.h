@@ -83,6 +83,40 @@ public:
 	
 	static TArray<UJointEdGraph*> GetAllGraphsFrom(const UJointManager* InJointManager);
 
+	/**
+	 * Get all the graphs of the provided Joint manager (the root graph first) without building a new array.
+	 * The graph hierarchy is cached on the root graph and rebuilt only after the hierarchy has been changed, so prefer this over GetAllGraphsFrom() for the frequent queries.
+	 * Don't hold the reference over the actions that can change the graph hierarchy - use GetAllGraphsFrom() to iterate the graphs in that case.
+	 * Joint 2.12.0 : Added.
+	 * @param InJointManager The Joint manager to get the graphs of.
+	 * @return The graphs of the Joint manager. Empty if the Joint manager has no graph.
+	 */
+	static const TArray<UJointEdGraph*>& GetCachedGraphsFrom(const UJointManager* InJointManager);
+
+	/**
+	 * Get all the graphs in the hierarchy this graph belongs to, the root graph first. See GetCachedGraphsFrom().
+	 */
+	const TArray<UJointEdGraph*>& GetCachedGraphHierarchy();
+
+	/**
+	 * Notify that a sub graph has been added to or removed from this graph. Must be called whenever the SubGraphs of the graph are changed.
+	 */
+	void NotifyGraphHierarchyChanged();
+
+private:
+
+	void CacheGraphHierarchy();
+
+private:
+
+	/**
+	 * The graphs in the hierarchy, the root graph first. Only used on the root graph.
+	 * The sub graphs are owned by their parent graphs, so raw pointers are fine here as long as the cache gets invalidated on the changes.
+	 */
+	TArray<UJointEdGraph*> CachedGraphHierarchy;
+
+	bool bGraphHierarchyDirty = true;
+
 public:
 
 	/**
@@ -206,8 +240,12 @@ public:
 
 	void ReallocateGraphPanelToGraphNodeSlates(TSharedPtr<SGraphPanel> GraphPanel);
 
-private:
-	
+public:
+
+	/**
+	 * Mark the cached node instances & graph nodes of this graph dirty. They will be rebuilt on the next access.
+	 * The graph actions take care of it by themselves. Call it when the sub node hierarchy of a node on this graph changes, since that is not a graph action.
+	 */
 	void RecacheNodes();
 
 public:
@@ -241,16 +279,35 @@ public:
 	 */
 	void InitializeCompileResultIfNeeded();
 
-	//Compile the graph.
-	void CompileAllJointGraphFromRoot();
+	/**
+	 * Compile the graph.
+	 * Joint 2.12.0 : Only the nodes that have been changed (and the nodes depending on them) are compiled. The others report their last compile result again.
+	 * The whole compilation is skipped if nothing has been changed since the last compilation.
+	 * @param bForceCompileAll Compile every node regardless of its compile result cache.
+	 */
+	void CompileAllJointGraphFromRoot(const bool bForceCompileAll = false);
 
 private:
 	
 	//Compile the provided graph node. Can choose whether to propagate to the children nodes.
-	void CompileJointGraphForNode(UJointEdGraphNode* Node, const bool bPropagateToSubNodes = true);
+	void CompileJointGraphForNode(UJointEdGraphNode* Node, const bool bPropagateToSubNodes, const bool bForceCompile, int32& OutCompiledNodeCount);
 	
 	//Compile the graph.
-	void CompileJointGraph();
+	void CompileJointGraph(const bool bForceCompile, int32& OutCompiledNodeCount);
+
+	/**
+	 * Calculate the hash of the compile contents of all the nodes in the graph hierarchy.
+	 * @param bOutAllNodesUpToDate Whether all the nodes' compile results are still valid.
+	 */
+	uint32 CalculateGraphCompileContentHash(bool& bOutAllNodesUpToDate);
+
+private:
+
+	/**
+	 * The content hash of the graph hierarchy on the last compilation in this session. The compilation is skipped if it matches.
+	 * Only used on the root graph.
+	 */
+	uint32 LastCompiledGraphContentHash = 0;
 
 public:
 	
@@ -259,7 +316,12 @@ public:
 		int NodeCount;
 		double ElapsedTime = 0;
 
-		FJointGraphCompileInfo(const int& InNodeCount, const double& InElapsedTime) : NodeCount(InNodeCount), ElapsedTime(InElapsedTime) {}
+		//The number of the nodes that have been actually compiled. The others reused their cached compile result.
+		int CompiledNodeCount = 0;
+
+		FJointGraphCompileInfo(const int& InNodeCount, const double& InElapsedTime) : NodeCount(InNodeCount), ElapsedTime(InElapsedTime), CompiledNodeCount(InNodeCount) {}
+		
+		FJointGraphCompileInfo(const int& InNodeCount, const double& InElapsedTime, const int& InCompiledNodeCount) : NodeCount(InNodeCount), ElapsedTime(InElapsedTime), CompiledNodeCount(InCompiledNodeCount) {}
 	};
 
 	DECLARE_DELEGATE_OneParam(FOnCompileFinished, const FJointGraphCompileInfo&)
@@ -298,13 +360,15 @@ public:
 
 	/**
 	 * Get cached Joint node instances. This action includes the sub nodes. (Sub nodes are not being stored in the Joint manager directly.)
+	 * Joint 2.12.0 : Returns a reference to the cache. The cache is kept up to date with the node additions & removals, and rebuilt lazily after the other changes on the graph.
 	 */
-	TSet<TWeakObjectPtr<UObject>> GetCachedJointNodeInstances(const bool bForceRecache = false);
+	const TSet<TWeakObjectPtr<UObject>>& GetCachedJointNodeInstances(const bool bForceRecache = false);
 	
 	/**
 	 * Get cached Joint graph nodes. This action includes the sub nodes. (Sub nodes are not being stored in the Joint manager directly.)
+	 * Joint 2.12.0 : Returns a reference to the cache. The cache is kept up to date with the node additions & removals, and rebuilt lazily after the other changes on the graph.
 	 */
-	TSet<TWeakObjectPtr<UJointEdGraphNode>> GetCachedJointGraphNodes(const bool bForceRecache = false);
+	const TSet<TWeakObjectPtr<UJointEdGraphNode>>& GetCachedJointGraphNodes(const bool bForceRecache = false);
 
 public:
 
@@ -333,6 +397,18 @@ private:
 	UPROPERTY(Transient)
 	TSet<TWeakObjectPtr<UJointEdGraphNode>> CachedJointGraphNodes;
 
+	bool bJointNodeInstancesDirty = true;
+
+	bool bJointGraphNodesDirty = true;
+
+private:
+
+	/**
+	 * Apply the node additions & removals of the provided action to the caches without rebuilding them.
+	 * @return false if the action can not be applied incrementally.
+	 */
+	bool UpdateNodeCachesForAction(const FEdGraphEditAction& InAction);
+
 private:
 	
 	FCriticalSection CachedJointNodeInstancesMutex;
@@ -374,6 +450,26 @@ public:
 	UPROPERTY()
 	bool bIsLocked = false;
 
+public:
+
+	/**
+	 * Start a bulk edit of the graph (e.g. pasting a large number of nodes).
+	 * While the graph is in a bulk edit, the graph change notifications are neither broadcast (so the graph editors don't create the node slates one by one) nor processed.
+	 * A single notification is made when the outermost bulk edit ends, if anything has been changed in the meantime.
+	 * Joint 2.12.0 : Introduced.
+	 */
+	void BeginBulkEdit();
+
+	void EndBulkEdit();
+
+	bool IsInBulkEdit() const;
+
+private:
+
+	int32 BulkEditDepth = 0;
+
+	bool bHasDeferredGraphChange = false;
+
 public:
 
 #if WITH_EDITOR
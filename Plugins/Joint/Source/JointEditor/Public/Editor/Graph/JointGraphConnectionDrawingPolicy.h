@@ -76,20 +76,8 @@ private:
 
 	//Wiggle Wire Simulator
 
-	/** Map storing the simulation state for each active wiggle wire connection. */
-	TMap<FGraphWireId, TSharedPtr<FWiggleWireSimulator>>& WireSimulators;
-	
-	/** Helper function to get or create a simulator for a given wire ID. */
-	TSharedPtr<FWiggleWireSimulator> GetOrAddSimulator(const FGraphWireId& Id); 
-	
-	/** Time since the last prune check for dead simulators. */
-	float TimeSinceLastPrune;
-
-	/** How often (in seconds) to check for and remove dead simulators. */
-	static constexpr float PRUNE_INTERVAL = 5.0f;
-
-	/** Prunes simulators associated with connections that no longer exist. */
-	void PruneDeadSimulators(const float DeltaTime);
+	/** The pool storing the simulation state of the wiggle wires of the graph. Stepped once per frame at the start of Draw(). */
+	FJointWiggleWirePool& WirePool;
 	
 	/**
 	 * Notifies the drawing policy that the graph view has changed (e.g., zoom, pan).
@@ -149,7 +149,7 @@ struct JOINTEDITOR_API FWiggleWireConfig
  * tension simulation for a more natural appearance.
  * @author David (hero2xyz), Huge thanks to him for the original implementation.
  */
-class JOINTEDITOR_API FWiggleWireSimulator: public TSharedFromThis<FWiggleWireSimulator>
+class JOINTEDITOR_API FWiggleWireSimulator
 {
 public:
     /** Constructor with default initialization. */
@@ -184,6 +184,15 @@ public:
     /** Checks if the simulation is actively updating. */
     bool IsActive() const;
 
+    /**
+     * Snaps the simulation to the resting state of the provided endpoints, without any motion.
+     * Used for the wires that enter the simulation while they are already in place.
+     */
+    void Settle(const FVector2D& StartPoint, const FVector2D& EndPoint, const FWiggleWireConfig& Config);
+
+    /** Checks if the provided endpoints differ from the ones the simulation has been last updated with. */
+    bool HasEndpointsMoved(const FVector2D& StartPoint, const FVector2D& EndPoint) const;
+
 public:
 
 	static TSharedPtr<FWiggleWireSimulator> MakeInstance();
@@ -248,6 +257,100 @@ private:
     static constexpr float DIRECTIONAL_ADJUSTMENT_SCALE = 0.7f;
 };
 
+/**
+ * Stores the wiggle wire simulators of a graph in one contiguous array, and steps them in a single batched pass per frame.
+ *
+ * The drawing policy only records the endpoints of the wires it draws (Touch()) and reads the current state back - it doesn't run any physics by itself.
+ * Step() then advances the wires that are awake, starting where the previous pass stopped if it ran out of its time budget.
+ * A wire sleeps once it has come to rest, or while it is not drawn (off-screen or culled), and wakes up when its endpoints move again.
+ * The wires that have not been drawn for a while are evicted, and the whole pool is released when its graph is closed.
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+class JOINTEDITOR_API FJointWiggleWirePool
+{
+
+public:
+
+	/**
+	 * Find the simulator of the provided wire, or add a new one in its resting state.
+	 * Records the endpoints & the config the wire will be stepped with, and wakes the wire up if it has been moved.
+	 * @return The simulator of the wire. Don't hold it over Step() - the array can be compacted there.
+	 */
+	const FWiggleWireSimulator& Touch(const FGraphWireId& Id, const FVector2D& StartPoint, const FVector2D& EndPoint, const FWiggleWireConfig& Config);
+
+	/**
+	 * Step the awake wires that have been drawn on the last frame. Only the first call on each frame does anything.
+	 * @param BudgetSeconds The time the pass can take. The wires that didn't make it are stepped first on the next pass, with the time they have missed.
+	 */
+	void Step(const double BudgetSeconds);
+
+	/** Wake up every wire in the pool, e.g. when the view has been changed. */
+	void ActivateAll();
+
+	int32 Num() const;
+
+	int32 NumAwake() const;
+
+public:
+
+	/** Get the pool of the provided graph, or create one. */
+	static FJointWiggleWirePool& FindOrAdd(const FGuid& GraphGuid);
+
+	/** Free the pool of the provided graph. Call it when the graph editor is closed. */
+	static void Release(const FGuid& GraphGuid);
+
+private:
+
+	void EvictStaleWires(const double CurrentTime);
+
+	void RemoveAtSwap(const int32 Index);
+
+private:
+
+	struct FWireEntry
+	{
+		FWireEntry(const FGraphWireId& InId) : Id(InId) {}
+
+		FGraphWireId Id;
+
+		/** The endpoints & the config the wire has been drawn with on its last frame. */
+		FVector2D StartPoint = FVector2D::ZeroVector;
+		FVector2D EndPoint = FVector2D::ZeroVector;
+		FWiggleWireConfig Config;
+
+		uint64 LastDrawnFrame = 0;
+		double LastDrawnTime = 0;
+		double LastStepTime = 0;
+	};
+
+	/** The simulators, in the same order as Entries. Kept apart from the entries so the batched pass walks over the simulation state only. */
+	TArray<FWiggleWireSimulator> Simulators;
+
+	TArray<FWireEntry> Entries;
+
+	TMap<FGraphWireId, int32> IndexMap;
+
+	/** The index the next pass starts from. Moves forward when a pass runs out of its budget, so every wire gets its turn. */
+	int32 StepCursor = 0;
+
+	uint64 LastSteppedFrame = 0;
+
+	double LastEvictionTime = 0;
+
+private:
+
+	/** How often (in seconds) to look for the wires that have not been drawn for a while. */
+	static constexpr double EVICTION_INTERVAL = 5.0;
+
+	/** How long (in seconds) a wire can stay undrawn before it is evicted. */
+	static constexpr double EVICTION_AGE = 10.0;
+
+	/** How many wires are stepped between the checks of the time budget. */
+	static constexpr int32 BUDGET_CHECK_INTERVAL = 32;
+
+};
+
 namespace JointGraphDrawPolicyEditorUtils
 {
     /**
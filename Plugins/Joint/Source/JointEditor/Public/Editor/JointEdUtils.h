@@ -158,6 +158,20 @@ public:
 
 	static void MoveNodesAtLocation(TSet<UEdGraphNode*> InNodes, const FVector2D& PasteLocation);
 
+	/**
+	 * Give the node instances of the pasted nodes names that don't conflict with the existing objects.
+	 * Unlike MarkNodesAsModifiedAndValidateName(), it doesn't record the nodes on the transaction. Call Modify() on them first if they are mutated in a transaction.
+	 * Joint 2.12.0 : Introduced.
+	 */
+	static void ValidateNameOfPastedNodes(const TSet<UEdGraphNode*>& InNodes);
+
+	/**
+	 * Remap the node pointers on the pasted nodes (and their sub nodes) that refer to the nodes copied in the same operation, so the pasted nodes refer to each other instead of the originals.
+	 * The pointers to any other node are kept as they are.
+	 * Joint 2.12.0 : Introduced.
+	 */
+	static void RemapNodePointersOfPastedNodes(const TSet<UEdGraphNode*>& InNodes);
+
 public:
 	
 	/**
@@ -176,6 +190,16 @@ public:
 
 	static EMessageSeverity::Type ResolveJointEdMessageSeverityToEMessageSeverity(const EJointEdMessageSeverity::Type JointEdLogMessage);
 
+	static EJointEdMessageSeverity::Type ResolveEMessageSeverityToJointEdMessageSeverity(const EMessageSeverity::Type MessageSeverity);
+
+public:
+
+	/**
+	 * Add the asset registry tags of the editor nodes of the provided Joint manager. Bound to FJointModule::OnGatherEditorAssetRegistryTags. See FJointAssetRegistryTags.
+	 * Joint 2.12.0 : Added.
+	 */
+	static void GatherEditorAssetRegistryTags(const UJointManager* Manager, TArray<UObject::FAssetRegistryTag>& OutTags);
+
 public:
 	
 	static void RemoveGraph(UJointEdGraph* GraphToRemove);
@@ -0,0 +1,191 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Misc/EngineVersionComparison.h"
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+#include "AssetData.h"
+#else
+#include "AssetRegistry/AssetData.h"
+#endif
+
+struct FStreamableHandle;
+class SNotificationItem;
+class SWidget;
+
+/**
+ * Remembers which packages a sweep has already processed, keyed by the saved hash of the package.
+ * A package is skipped on the next sweep as long as it has not been saved again (and is not dirty in memory).
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+class JOINTEDITOR_API FJointAssetSweepCache
+{
+
+public:
+
+	/**
+	 * Whether the package of the provided asset has been processed already with its current saved hash.
+	 */
+	bool IsUpToDate(const FAssetData& AssetData) const;
+
+	/**
+	 * Record the current saved hash of the package of the provided asset.
+	 */
+	void Record(const FAssetData& AssetData);
+
+	void Forget(const FName& PackageName);
+
+	void Reset();
+
+public:
+
+	/**
+	 * Get the saved hash of the package from the asset registry. Empty if the package is dirty in memory, since the saved hash doesn't represent it anymore.
+	 */
+	static FString GetPackageSavedHash(const FName& PackageName);
+
+private:
+
+	TMap<FName, FString> ProcessedPackageHashes;
+
+};
+
+/**
+ * A background sweep over the assets of the project for the management operations.
+ *
+ * The assets are filtered with their asset registry data first (without loading them), skipped if the cache says they haven't been changed since the last sweep,
+ * and the rest is loaded asynchronously in batches and processed in time sliced steps, so the editor stays responsive even with thousands of assets.
+ * The sweep shows its progress on a notification that can cancel it.
+ *
+ * The owner must call Tick() regularly until it returns false. The widgets can use StartOnWidget() to tick it with their active timer.
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+class JOINTEDITOR_API FJointAssetSweep : public TSharedFromThis<FJointAssetSweep>
+{
+
+public:
+
+	FJointAssetSweep(const FText& InSweepName, const TArray<FAssetData>& InAssets);
+
+	~FJointAssetSweep();
+
+public:
+
+	/**
+	 * Filter the assets with their asset registry data (tags) before loading them. Return false to skip the asset.
+	 * It is tested before the cache, so it can forget the cache entry of an asset to have it processed again.
+	 */
+	TFunction<bool(const FAssetData&)> AssetFilter;
+
+	/**
+	 * Process the loaded asset. Called on the game thread.
+	 */
+	TFunction<void(UObject*, const FAssetData&)> ProcessAsset;
+
+	/**
+	 * Called once when the sweep has been finished or cancelled.
+	 */
+	TFunction<void(const FJointAssetSweep&)> OnFinished;
+
+	/**
+	 * Optional. The packages that have not been changed since they were recorded in the cache will be skipped.
+	 */
+	TSharedPtr<FJointAssetSweepCache> Cache;
+
+public:
+
+	void Start();
+
+	/**
+	 * Start the provided sweep and tick it with an active timer of the owner widget until it ends. Only one sweep can run on the slot at a time.
+	 * @param OwnerWidget The widget that ticks the sweep.
+	 * @param InOutActiveSweep The slot of the owner widget that holds its running sweep. Reset when the sweep ends.
+	 * @param Sweep The sweep to start.
+	 * @return Whether the sweep has been started.
+	 */
+	static bool StartOnWidget(const TSharedRef<SWidget>& OwnerWidget, TSharedPtr<FJointAssetSweep>& InOutActiveSweep, const TSharedRef<FJointAssetSweep>& Sweep);
+
+	/**
+	 * Advance the sweep within the time budget.
+	 * @return Whether the sweep is still running.
+	 */
+	bool Tick();
+
+	void Cancel();
+
+public:
+
+	bool IsRunning() const;
+
+	bool IsCancelled() const;
+
+	int32 GetNumTotal() const;
+
+	int32 GetNumProcessed() const;
+
+	/**
+	 * The number of the assets that have been skipped by the filter or the cache.
+	 */
+	int32 GetNumSkipped() const;
+
+public:
+
+	/**
+	 * Collect the asset data of every asset of the provided class in the project from the asset registry.
+	 */
+	static void GetAssetsOfClass(const UClass* Class, TArray<FAssetData>& OutAssets);
+
+	/**
+	 * Whether the Joint manager asset may contain a node, a fragment or an editor node of the provided class, judging by its asset registry tags. See FJointAssetRegistryTags.
+	 * Always true if the asset has not been saved with the tags yet (or is loaded already), since it can't be told without loading it.
+	 */
+	static bool MayContainClass(const FAssetData& AssetData, const UClass* Class);
+
+	/**
+	 * Whether the Joint manager asset may have a node of a missing blueprint or native class, judging by its asset registry tags. See FJointAssetRegistryTags.
+	 * Always true if the asset has not been saved with the tags yet (or is loaded already), since it can't be told without loading it.
+	 */
+	static bool MayHaveMissingClasses(const FAssetData& AssetData);
+
+private:
+
+	void RequestNextBatch();
+
+	void OnBatchLoaded(TArray<FAssetData> LoadedBatch);
+
+	void Finish();
+
+	void UpdateNotification() const;
+
+private:
+
+	FText SweepName;
+
+	TArray<FAssetData> PendingAssets;
+
+	TArray<FAssetData> ReadyAssets;
+
+	TSharedPtr<FStreamableHandle> LoadingHandle;
+
+	//The handles of the loaded batches. Keep the assets of the ready queue from being garbage collected until they are processed.
+	TArray<TSharedPtr<FStreamableHandle>> LoadedHandles;
+
+	bool bIsBatchLoading = false;
+
+	TSharedPtr<SNotificationItem> Notification;
+
+	int32 NumTotal = 0;
+
+	int32 NumProcessed = 0;
+
+	int32 NumSkipped = 0;
+
+	bool bIsRunning = false;
+
+	bool bIsCancelled = false;
+
+};
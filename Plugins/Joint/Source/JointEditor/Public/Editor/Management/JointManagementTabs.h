@@ -18,6 +18,9 @@ class UJointManager;
 
 class FTabManager;
 
+class FJointAssetSweep;
+class FJointAssetSweepCache;
+
 namespace JointEditorTabs
 {
 }
@@ -75,6 +78,16 @@ public:
 
 	FReply UpdateBPNodeEdSettings();
 
+public:
+
+	/**
+	 * The sweep that is running on this widget. See FJointAssetSweep::StartOnWidget().
+	 */
+	TSharedPtr<FJointAssetSweep> ActiveSweep;
+
+	//The packages that the cleanup has been processed already. Only the packages that have been saved since then are visited again.
+	TSharedPtr<FJointAssetSweepCache> CleanUpSweepCache;
+
 public:
 	FReply ResetAllEditorStyle();
 	FReply ResetGraphEditorStyle();
@@ -157,6 +170,22 @@ public:
 
 	FReply MissingClassRefresh();
 
+	//Rebuild the missing class list from the class cache.
+	void PopulateMissingClassList();
+
+public:
+
+	/**
+	 * The sweep that is running on this widget. See FJointAssetSweep::StartOnWidget().
+	 */
+	TSharedPtr<FJointAssetSweep> ActiveSweep;
+
+	//The packages that the missing class sweep has been processed already. Only the packages that have been saved since then are visited again.
+	TSharedPtr<FJointAssetSweepCache> MissingClassSweepCache;
+
+	//The missing classes found on each package on the missing class sweeps.
+	TMap<FName, TArray<FJointGraphNodeClassData>> MissingClassesByPackage;
+
 public:
 	TSharedPtr<class SScrollBox> MissingClassScrollBox;
 	TSharedPtr<class SScrollBox> RedirectionScrollBox;
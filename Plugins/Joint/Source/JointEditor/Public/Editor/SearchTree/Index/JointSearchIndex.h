@@ -0,0 +1,138 @@
+//Copyright 2022~2024 DevGrain. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Misc/EngineVersionComparison.h"
+#if UE_VERSION_OLDER_THAN(5, 1, 0)
+#include "AssetData.h"
+#else
+#include "AssetRegistry/AssetData.h"
+#endif
+
+class UJointManager;
+class UPackage;
+class FObjectPostSaveContext;
+
+/**
+ * A persistent trigram index of the searchable texts of the Joint managers in the project - the names & the titles of the graphs and the nodes,
+ * the names, the types and the exported values of the properties the search tree shows (which includes the node tags).
+ *
+ * Each asset is indexed with the sorted set of the trigrams of its texts, normalized the same way the search tree normalizes the filter strings.
+ * A query is split into its literal terms, and an asset is a candidate only if it has every trigram of every term. It can give false positives (never false negatives),
+ * so the search tree still filters the items of the candidates as usual - it just doesn't have to load & build the assets that can't match.
+ *
+ * The index is updated whenever a Joint manager is saved (or indexed by a sweep), and stored in the Saved folder of the project.
+ * An entry is trusted only while the saved hash of the package in the asset registry hasn't been changed since it was indexed, so the packages changed outside the editor (e.g. by the source control) are treated as unknown.
+ * The asset registry data is in memory, so a query doesn't touch the disk for the packages.
+ *
+ * Joint 2.12.0 : Introduced.
+ */
+class JOINTEDITOR_API FJointSearchIndex
+{
+
+public:
+
+	FJointSearchIndex();
+
+	~FJointSearchIndex();
+
+public:
+
+	/**
+	 * Index the provided Joint manager with its current content. The unsaved changes are indexed as well, but the entry is trusted only after the package has been saved.
+	 */
+	void IndexJointManager(const UJointManager* InJointManager);
+
+	void RemovePackage(const FName& PackageName);
+
+	/**
+	 * Whether the package of the provided asset has been indexed with its current saved content.
+	 */
+	bool IsUpToDate(const FAssetData& AssetData) const;
+
+	/**
+	 * Collect the assets that may match the provided search query.
+	 * The assets that are not indexed (or are out of date, or loaded and dirty) are always collected, since they can't be told without loading them.
+	 * @param Query The search query as it is typed in the search box.
+	 * @param InAssets The assets to test.
+	 * @param OutCandidates The assets that may match the query.
+	 * @return Whether the query could be used to narrow down the assets at all. If false, every asset has been collected.
+	 */
+	bool Query(const FString& Query, const TArray<FAssetData>& InAssets, TArray<FAssetData>& OutCandidates);
+
+	int32 Num() const;
+
+public:
+
+	void Load();
+
+	void Save();
+
+	/**
+	 * Save the index only if it has been changed since the last save.
+	 */
+	void SaveIfDirty();
+
+public:
+
+	/**
+	 * Collect the searchable texts of the provided Joint manager, normalized for the indexing. See FJointTreeItem::GetFilterString().
+	 */
+	static void CollectSearchableTexts(const UJointManager* InJointManager, TArray<FString>& OutTexts);
+
+	/**
+	 * Split the provided query into the literal terms that every match must contain, normalized for the indexing.
+	 * @return false if the query has an operator that can't be narrowed down with the terms (e.g. OR or NOT).
+	 */
+	static bool ExtractQueryTerms(const FString& Query, TArray<FString>& OutTerms);
+
+	static FString GetIndexFilePath();
+
+private:
+
+	struct FEntry
+	{
+		/** The saved hash of the package the entry has been indexed with. See FJointAssetSweepCache::GetPackageSavedHash(). Empty if the package was dirty at the moment. */
+		FString PackageSavedHash;
+
+		/** The sorted unique trigrams of the texts of the asset. */
+		TArray<uint32> Trigrams;
+	};
+
+	bool MayMatch(const FEntry& Entry, const TArray<TArray<uint32>>& TermTrigrams) const;
+
+	/**
+	 * Take the saved hashes of the packages that have been saved since the last query. The asset registry picks up the saved files later than the save event.
+	 */
+	void ResolveAwaitingSavedHashes();
+
+private:
+
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+
+	void OnAssetRemoved(const FAssetData& AssetData);
+
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+private:
+
+	TMap<FName, FEntry> Entries;
+
+	/** The packages that have been indexed on their save, and the saved hash they had before the save. The new hash is taken once the asset registry has it. */
+	TMap<FName, FString> PackagesAwaitingSavedHash;
+
+	bool bIsLoaded = false;
+
+	bool bIsDirty = false;
+
+private:
+
+	FDelegateHandle PackageSavedHandle;
+
+	FDelegateHandle AssetRemovedHandle;
+
+	FDelegateHandle AssetRenamedHandle;
+
+};
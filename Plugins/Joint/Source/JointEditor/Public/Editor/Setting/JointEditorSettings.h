@@ -31,6 +31,7 @@ namespace JointEditorDefaultSettings
 	static const FLinearColor CenterGridColor(FColor(5, 5, 9, 255));
 	static const float SmallestGridSize(100);
 	static const float GridSnapSize(5);
+	static const bool bUseZoomBasedNodeLOD(true);
 
 	//Graph Editor - Pin / Connection
 	static const FLinearColor NormalConnectionColor(FLinearColor(0.15, 0.15, 0.20, 1));
@@ -88,6 +89,8 @@ namespace JointEditorDefaultSettings
 	static const bool bUseWiggleWireForSelfConnection(false);
 	static const bool bUseWiggleWireForPreviewConnection(true);
 
+	static const float WiggleWireSimulationTimeBudget(1.0f);
+
 	static const FWiggleWireConfig WiggleWireConfig(
 		100,
 		0.1,
@@ -181,6 +184,13 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Joint Graph Editor", meta = (DisplayName = "Grid Snap Size"))
 	float GridSnapSize = JointEditorDefaultSettings::GridSnapSize;
 
+	/**
+	 * Collapse the graph nodes into a simple proxy while the graph is zoomed out, and build the fragment slates of a node only when it becomes visible in detail zoom for the first time.
+	 * Recommended for the graphs with a lot of nodes. Reopen the graph to apply the change.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Joint Graph Editor", meta = (DisplayName = "Use Zoom Based Node LOD"))
+	bool bUseZoomBasedNodeLOD = JointEditorDefaultSettings::bUseZoomBasedNodeLOD;
+
 public:
 	/** Defines a scaling factor for font size in the context text editor. */
 	UPROPERTY(Config, EditAnywhere, Category = "Context Text Editor",meta = (DisplayName = "Context Text Editor Font Size Multiplier"))
@@ -329,6 +339,13 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Pin / Pin Connection - Physics-Based Wiggle Wire Rendering (Beta)",meta = (DisplayName = "Preview Connection Wiggle Wire Renderer Config"))
 	FWiggleWireConfig PreviewConnectionWiggleWireConfig = JointEditorDefaultSettings::WiggleWireConfig;
 
+	/**
+	 * The time (in milliseconds) the wiggle wires of a graph can take to be simulated on each frame.
+	 * The wires that don't make it in time are simulated first on the next frame. The wires at rest and the off-screen wires are not simulated at all.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Pin / Pin Connection - Physics-Based Wiggle Wire Rendering (Beta)",meta = (DisplayName = "Wiggle Wire Simulation Time Budget (ms)", ClampMin = "0.05", UIMin = "0.05", UIMax = "10.0"))
+	float WiggleWireSimulationTimeBudget = JointEditorDefaultSettings::WiggleWireSimulationTimeBudget;
+
 public:
 	
 	/** Specifies the color applied to nodes that are currently active and executing in the debugger. */
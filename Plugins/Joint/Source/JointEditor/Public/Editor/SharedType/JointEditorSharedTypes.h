@@ -178,6 +178,16 @@ struct JOINTEDITOR_API FJointGraphNodeClassNode
 	void AddUniqueSubNode(TSharedPtr<FJointGraphNodeClassNode> SubNode);
 };
 
+/**
+ * The class database of a root class - every native & blueprint subclass of it, in their hierarchy.
+ * The editor module keeps one for the nodes & fragments and one for the editor nodes, and the palette, the context menus and the missing class scanner all share them.
+ *
+ * The native classes are enumerated with GetDerivedClasses() and the blueprint classes are read from the asset registry (their parent class tags), so no class or blueprint has to be loaded to build it.
+ * Once built, it is updated incrementally - the assets that are added or removed are attached to or detached from the hierarchy, and a blueprint compile refreshes only the blueprint classes.
+ * Only the hot reloads (and the class packages that are loaded or unloaded) make it rebuild everything.
+ *
+ * Joint 2.12.0 : Keeps a class name lookup & the gathered class lists, instead of searching the hierarchy & rebuilding the lists on every query.
+ */
 struct JOINTEDITOR_API FJointGraphNodeClassHelper
 {
 	DECLARE_MULTICAST_DELEGATE(FOnPackageListUpdated);
@@ -192,6 +202,10 @@ struct JOINTEDITOR_API FJointGraphNodeClassHelper
 	void OnAssetRemoved(const struct FAssetData& AssetData);
 	void InvalidateCache();
 	void OnReloadComplete(EReloadCompleteReason Reason);
+	void OnBlueprintCompiled();
+
+	/** Whether the database has a blueprint class that is generated in the provided package. */
+	bool ContainsClassPackage(const FString& PackageName);
 
 public:
 
@@ -226,7 +240,31 @@ private:
 	void BuildClassGraph();
 	void AddClassGraphChildren(TSharedPtr<FJointGraphNodeClassNode> Node, TArray<TSharedPtr<FJointGraphNodeClassNode> >& NodeList);
 
+	/** Create the nodes of the blueprint classes derived from the root class, out of the asset registry data. */
+	void GatherBlueprintClassNodes(TArray<TSharedPtr<FJointGraphNodeClassNode>>& OutNodeList);
+
+	/** Detach the blueprint classes from the hierarchy and attach them again with the current asset registry data. The native classes are kept as they are. */
+	void RefreshBlueprintClassNodes();
+
+	void RebuildClassNodeMap();
+	void AddClassNodeToMap(const TSharedPtr<FJointGraphNodeClassNode>& Node);
+	void RemoveClassNodeFromMap(const TSharedPtr<FJointGraphNodeClassNode>& Node);
+
+	/** Drop the gathered class lists. Call it whenever the hierarchy has been changed. */
+	void ResetGatheredClasses();
+
 	bool IsHidingClass(UClass* Class);
 	bool IsHidingParentClass(UClass* Class);
 	bool IsPackageSaved(FName PackageName);
+
+private:
+
+	/** The nodes of the hierarchy by their class names. */
+	TMap<FString, TSharedPtr<FJointGraphNodeClassNode>> ClassNodeMap;
+
+	/** The class lists GatherClasses() has made for each base class, until the hierarchy is changed. */
+	TMap<FString, TArray<FJointGraphNodeClassData>> GatheredClasses;
+
+	/** Set when a blueprint has been compiled. The blueprint classes are refreshed on the next query. */
+	bool bBlueprintClassNodesDirty = false;
 };
@@ -11,6 +11,7 @@
 
 class UJointManager;
 class SJointTree;
+class FJointAssetSweep;
 
 class JOINTEDITOR_API SJointBulkSearchReplace : public SCompoundWidget
 {
@@ -67,6 +68,28 @@ public:
 	
 	FGetCurrentSelectionDelegate GetCurrentSelectionDelegate;
 
+public:
+
+	/**
+	 * Search the query through every Joint manager in the project.
+	 * The search index narrows down the candidates first, so only the assets that may match the query will be loaded and built on the tree.
+	 * Joint 2.12.0 : Introduced.
+	 */
+	void OnProjectSearchTextCommitted(const FText& Text, ETextCommit::Type Arg);
+
+	/**
+	 * Index the Joint managers in the project that are not indexed with their current content yet.
+	 * Joint 2.12.0 : Introduced.
+	 */
+	FReply OnUpdateSearchIndexButtonPressed();
+
+public:
+
+	/**
+	 * The sweep that is running on this widget. See FJointAssetSweep::StartOnWidget().
+	 */
+	TSharedPtr<FJointAssetSweep> ActiveSweep;
+
 };
 
 
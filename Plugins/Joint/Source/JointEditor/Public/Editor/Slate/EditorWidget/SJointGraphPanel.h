@@ -97,6 +97,16 @@ public:
 	
 	virtual int32 OnPaint( const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled ) const override;
 
+	virtual void Tick( const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime ) override;
+
+public:
+
+	/**
+	 * Build the deferred sub node slates of the nodes that are visible in detail zoom. See SJointGraphNodeBase::RealizeDeferredSubNodeSlates().
+	 * Joint 2.12.0 : Introduced.
+	 */
+	void RealizeVisibleNodes(const FGeometry& AllottedGeometry);
+
 
 public:
 
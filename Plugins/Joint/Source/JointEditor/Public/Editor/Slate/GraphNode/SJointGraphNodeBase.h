@@ -609,6 +609,54 @@ public:
 public:
 
 	const EJointEdSlateDetailLevel::Type GetSlateDetailLevel() const;
+
+public:
+
+	/**
+	 * Zoom based LOD of the node. See UJointEditorSettings::bUseZoomBasedNodeLOD.
+	 * While the graph is zoomed out, the node shows a simple proxy instead of its content, and the sub node slates are not built until the node becomes visible in detail zoom for the first time.
+	 * Joint 2.12.0 : Introduced.
+	 */
+	static bool IsZoomBasedLODEnabled();
+
+	/**
+	 * Whether the nodes show their proxy on the provided LOD of the graph panel.
+	 */
+	static bool ShouldShowLODProxyOn(const EGraphRenderingLOD::Type LOD);
+
+	bool IsShowingLODProxy() const;
+
+	/**
+	 * Whether the sub node slates of this node have been deferred until the node becomes visible in detail zoom.
+	 */
+	bool HasDeferredSubNodeSlates() const;
+
+	/**
+	 * Build the sub node slates that have been deferred. The owner panel calls this when the node becomes visible in detail zoom.
+	 */
+	void RealizeDeferredSubNodeSlates();
+
+	virtual TSharedRef<SWidget> CreateLODProxy();
+
+	EVisibility GetDetailContentVisibility() const;
+
+	EVisibility GetLODProxyVisibility() const;
+
+private:
+
+	bool ShouldDeferSubNodeSlates() const;
+
+private:
+
+	/** Whether PopulateNodeSlates() has built the proxy for this node. The nodes that populate their own layout never show the proxy. */
+	bool bHasLODProxy = false;
+
+	bool bHasDeferredSubNodeSlates = false;
+
+	bool bHasRealizedSubNodeSlates = false;
+
+	/** The desired size of the node in detail zoom. The proxy keeps the node at this size, so the layout and the connections don't jump while zooming. */
+	mutable FVector2D CachedDetailDesiredSize = FVector2D::ZeroVector;
 };
 
 template <typename SlateClass>
@@ -14,6 +14,7 @@ class FJointManagementTabHandler;
 class FJointEditorToolkit;
 class UJointDebugger;
 class FJointGraphPinSlateFactory;
+class FJointSearchIndex;
 struct FJointGraphNodeSlateFactory;
 
 class IAssetTypeActions;
@@ -121,6 +122,14 @@ public:
 	/** Unregisters debugger. */
 	void UnregisterDebugger();
 
+public:
+
+	/** Registers the gatherer of the editor-only asset registry tags of the Joint managers. */
+	void RegisterAssetRegistryTagGatherer();
+
+	/** Unregisters the gatherer of the editor-only asset registry tags of the Joint managers. */
+	void UnregisterAssetRegistryTagGatherer();
+
 public:
 
 	FDelegateHandle JointNativeMovieTrackCreateEditorHandle;
@@ -162,6 +171,18 @@ private:
 	
 	TSharedPtr<FJointGraphNodeClassHelper> ClassCache;
 
+public:
+
+	/**
+	 * The search index of the Joint managers in the project. The bulk search uses it to skip the assets that can't match the query without loading them.
+	 * Joint 2.12.0 : Introduced.
+	 */
+	TSharedPtr<FJointSearchIndex> GetSearchIndex();
+
+private:
+
+	TSharedPtr<FJointSearchIndex> SearchIndex;
+
 public:
 	
 	/**
@@ -110,6 +110,34 @@ public:
 	 */
 	TArray<TSharedPtr<class FTokenizedMessage>> CompileMessages;
 
+private:
+
+	/**
+	 * The content hash of the node at the time of its last compilation. See GetCompileContentHash().
+	 * Saved with the asset, so the node doesn't need to be compiled again on the next session (or for the other cook platforms) if nothing has been changed.
+	 * Joint 2.12.0 : Added.
+	 */
+	UPROPERTY()
+	uint32 CompiledContentHash = 0;
+
+	/**
+	 * The compile messages of the last compilation, saved with the asset. Restored to the CompileMessages when the node skips the compilation.
+	 * Joint 2.12.0 : Added.
+	 */
+	UPROPERTY()
+	TArray<FJointEdLogMessage> CachedCompileMessages;
+
+	/**
+	 * The hash of the node's own data (node instance properties, connections, sub nodes). Only recalculated when the node has been marked dirty.
+	 */
+	uint32 CachedContentHash = 0;
+
+	//Whether the CachedContentHash must be recalculated.
+	bool bCompileContentDirty = true;
+
+	//Whether the node must be compiled on the next compilation even if its content hash didn't change. Set when the nodes this node depends on have been changed.
+	bool bCompileRequested = false;
+
 public:
 	
 	/**
@@ -646,6 +674,21 @@ public:
 	virtual void PostEditImport() override;
 	virtual void PostEditUndo() override;
 
+	/**
+	 * The guid the node instance had before it was imported (pasted) with a new one. Invalid if the node has not been pasted in this session.
+	 * Used to remap the references between the nodes that have been copied together.
+	 * Joint 2.12.0 : Introduced.
+	 */
+	const FGuid& GetCopiedNodeInstanceGuid() const { return CopiedNodeInstanceGuid; }
+
+private:
+
+	FGuid CopiedNodeInstanceGuid;
+
+public:
+
+	virtual void PinConnectionListChanged(UEdGraphPin* Pin) override;
+
 	virtual void ReconstructNode() override;
 	virtual void DestroyNode() override;
 
@@ -780,11 +823,56 @@ public:
 	//Return true if this node has any compile result messages to display.
 	bool HasCompileIssues() const;
 
+public:
+
+	/**
+	 * Mark this node to be compiled on the next compilation of the graph.
+	 * Called on the property changes, pin connection changes and sub node changes of the node.
+	 * @param bPropagateToDependents Whether to mark the nodes that depend on this node as well - the nodes connected to its pins and its parent node.
+	 * Joint 2.12.0 : Added.
+	 */
+	void MarkCompileContentDirty(const bool bPropagateToDependents = true);
+
+	/**
+	 * Get the hash of everything the compilation of this node depends on - the node instance properties, the pin connections, the sub nodes, the reachability of the node,
+	 * and the state of the node class (its blueprint package, property layout and default values).
+	 * Joint 2.12.0 : Added.
+	 */
+	uint32 GetCompileContentHash();
+
+	/**
+	 * Drop the class part of the content hashes, so the classes will be hashed again. Called at the start of each graph compilation.
+	 * Joint 2.12.0 : Added.
+	 */
+	static void ResetNodeClassContentHashCache();
+
+	/**
+	 * Whether the result of the last compilation is still valid for the current content of the node.
+	 * Joint 2.12.0 : Added.
+	 */
+	bool IsCompileResultUpToDate();
+
+	/**
+	 * Report the result of the last compilation again without compiling the node.
+	 * Restores the saved compile messages if the node hasn't been compiled in this session yet.
+	 * Joint 2.12.0 : Added.
+	 */
+	void RestoreCompileResult(const TSharedPtr<class IMessageLogListing>& CompileResultMessage);
+
+private:
+
+	uint32 CalculateCompileContentHash() const;
+
+	void CacheCompileResult();
+
+	void ReportCompileResult(const TSharedPtr<class IMessageLogListing>& CompileResultMessage);
+
 private:
 
 	FORCEINLINE void AttachDeprecationCompilerMessage();
 	FORCEINLINE void AttachPropertyCompilerMessage();
 	FORCEINLINE void CompileAndAttachNodeInstanceCompilationMessages();
+	FORCEINLINE void AttachReachabilityCompilerMessage();
 
 public:
 